@@ -22,6 +22,14 @@ pub const MaxVertexAttributes: u32 = 15;
 
 pub const ShaderStageCount: u32 = 6;
 
+pub const InvalidBindingSlot: u32 = 0;
+
+pub const InvalidBindlessIndex: u32 = 4294967295;
+
+pub const InvalidPushConstantSlot: u32 = 4294967295;
+
+pub const InvalidUploadToken: u64 = 0xFFFFFFFFFFFFFFFF;
+
 pub const Backend = enum(u32) {
     vulkan, // ( 0)                         Vulkan
     d3d12, // ( 1)                          D3D12
@@ -409,6 +417,11 @@ pub const QueryType = enum(u32) {
     occlusion, // ( 2)
 };
 
+pub const RenderPassContents = enum(u32) {
+    inline_commands, // ( 0)
+    secondary_command_buffers, // ( 1)
+};
+
 pub const ResourceState = packed struct(u32) {
     vertex_and_constant_buffer: bool = false, // ( 0)
     index_buffer: bool = false, // ( 1)
@@ -665,6 +678,8 @@ pub const PresentError = enum(u32) {
 
 pub const LogCallback = fn (user_data: ?*anyopaque, severity: LogSeverity, fmt: [*:0]const u8, ...) callconv(.C) void;
 
+pub const ReadbackCallback = fn (user_data: ?*anyopaque, data: *const anyopaque, size: u64) callconv(.C) void;
+
 pub const Malloc = fn (user_data: ?*anyopaque, size: usize, pool: ?*const anyopaque) callconv(.C) ?*anyopaque;
 
 pub const Realloc = fn (user_data: ?*anyopaque, ptr: ?*anyopaque, size: usize, pool: ?*const anyopaque) callconv(.C) ?*anyopaque;
@@ -705,6 +720,10 @@ pub const CreateDevice = fn (adapter: AdapterId, desc: *const DeviceDescriptor)
 
 pub const FreeDevice = fn (adapter: AdapterId, device: DeviceId) callconv(.C) void;
 
+pub const GetPipelineCacheData = fn (device: DeviceId, size: usize, data: ?*anyopaque) callconv(.C) usize;
+
+pub const QueryDescriptorPoolStats = fn (device: DeviceId, stats: *DescriptorPoolStats) callconv(.C) void;
+
 pub const QueryVideoMemoryInfo = fn (device: DeviceId, total: *u64, used_bytes: *u64) callconv(.C) void;
 
 pub const QuerySharedMemoryInfo = fn (device: DeviceId, total: *u64, used_bytes: *u64) callconv(.C) void;
@@ -723,6 +742,16 @@ pub const CreateSemaphore = fn (device: DeviceId) callconv(.C) ?SemaphoreId;
 
 pub const FreeSemaphore = fn (device: DeviceId, semaphore: SemaphoreId) callconv(.C) void;
 
+pub const CreateTimelineSemaphore = fn (device: DeviceId, initial_value: u64) callconv(.C) ?TimelineSemaphoreId;
+
+pub const FreeTimelineSemaphore = fn (device: DeviceId, semaphore: TimelineSemaphoreId) callconv(.C) void;
+
+pub const SignalTimelineSemaphore = fn (semaphore: TimelineSemaphoreId, value: u64) callconv(.C) void;
+
+pub const WaitTimelineSemaphores = fn (semaphore_count: u32, p_semaphores: [*]const TimelineSemaphoreId, p_values: [*]const u64, timeout_ns: u64) callconv(.C) bool;
+
+pub const QueryTimelineSemaphoreValue = fn (semaphore: TimelineSemaphoreId) callconv(.C) u64;
+
 pub const CreateRootSignaturePool = fn (device: DeviceId, desc: *const RootSignaturePoolDescriptor) callconv(.C) ?RootSignaturePoolId;
 
 pub const FreeRootSignaturePool = fn (device: DeviceId, pool: RootSignaturePoolId) callconv(.C) void;
@@ -737,6 +766,24 @@ pub const UpdateDescriptorSet = fn (set: DescriptorSetId, data_count: u32, p_dat
 
 pub const FreeDescriptorSet = fn (device: DeviceId, set: DescriptorSetId) callconv(.C) void;
 
+pub const CreateDescriptorArena = fn (device: DeviceId, desc: *const DescriptorArenaDescriptor) callconv(.C) ?DescriptorArenaId;
+
+pub const DescriptorArenaAllocateSet = fn (arena: DescriptorArenaId, desc: *const DescriptorSetDescriptor) callconv(.C) ?DescriptorSetId;
+
+pub const ResetDescriptorArena = fn (arena: DescriptorArenaId) callconv(.C) void;
+
+pub const FreeDescriptorArena = fn (device: DeviceId, arena: DescriptorArenaId) callconv(.C) void;
+
+pub const RegisterBindlessTextureView = fn (device: DeviceId, view: TextureViewId) callconv(.C) u32;
+
+pub const RegisterBindlessBuffer = fn (device: DeviceId, buffer: BufferId) callconv(.C) u32;
+
+pub const UnregisterBindlessTextureView = fn (device: DeviceId, index: u32) callconv(.C) void;
+
+pub const UnregisterBindlessBuffer = fn (device: DeviceId, index: u32) callconv(.C) void;
+
+pub const AdvanceBindlessFrame = fn (device: DeviceId, fence: ?FenceId) callconv(.C) void;
+
 pub const CreateComputePipeline = fn (device: DeviceId, desc: *const ComputePipelineDescriptor) callconv(.C) ?ComputePipelineId;
 
 pub const FreeComputePipeline = fn (device: DeviceId, pipeline: ComputePipelineId) callconv(.C) void;
@@ -753,10 +800,14 @@ pub const CreateMemoryPool = fn (device: DeviceId, desc: *const MemoryPoolDescri
 
 pub const FreeMemoryPool = fn (device: DeviceId, pool: MemoryPoolId) callconv(.C) void;
 
+pub const QueryMemoryPoolStatistics = fn (pool: MemoryPoolId, stats: *MemoryPoolStatistics) callconv(.C) void;
+
 pub const GetQueue = fn (device: DeviceId, _type: QueueType, index: u32) callconv(.C) ?QueueId;
 
 pub const SubmitQueue = fn (queue: QueueId, desc: *const QueueSubmitDescriptor) callconv(.C) SubmitError;
 
+pub const SubmitQueueBatches = fn (queue: QueueId, batch_count: u32, p_descs: [*]const QueueSubmitDescriptor) callconv(.C) SubmitError;
+
 pub const QueuePresent = fn (queue: QueueId, desc: *const QueuePresentDescriptor) callconv(.C) PresentError;
 
 pub const WaitQueueIdle = fn (queue: QueueId) callconv(.C) void;
@@ -801,6 +852,8 @@ pub const MapBuffer = fn (buffer: BufferId, range: ?*const BufferRange) callconv
 
 pub const UnmapBuffer = fn (buffer: BufferId) callconv(.C) void;
 
+pub const InvalidateBuffer = fn (buffer: BufferId, range: ?*const BufferRange) callconv(.C) void;
+
 pub const FreeBuffer = fn (device: DeviceId, buffer: BufferId) callconv(.C) void;
 
 pub const CreateSampler = fn (device: DeviceId, desc: *const SamplerDescriptor) callconv(.C) ?SamplerId;
@@ -829,6 +882,10 @@ pub const FreeSwapChain = fn (device: DeviceId, swapchain: SwapChainId) callconv
 
 pub const CmdBegin = fn (cmd: CommandBufferId) callconv(.C) void;
 
+pub const CmdBeginSecondary = fn (cmd: CommandBufferId, inheritance: *const CommandBufferInheritanceInfo) callconv(.C) ?RenderPassEncoderId;
+
+pub const CmdExecuteSecondaries = fn (cmd: CommandBufferId, count: u32, p_secondaries: [*]const CommandBufferId) callconv(.C) void;
+
 pub const CmdTransferBufferToBuffer = fn (cmd: CommandBufferId, desc: *const BufferToBufferTransfer) callconv(.C) void;
 
 pub const CmdTransferTextureToTexture = fn (cmd: CommandBufferId, desc: *const TextureToTextureTransfer) callconv(.C) void;
@@ -849,6 +906,8 @@ pub const CmdResolveQuery = fn (cmd: CommandBufferId, pool: QueryPoolId, readbac
 
 pub const CmdEnd = fn (cmd: CommandBufferId) callconv(.C) void;
 
+pub const QueryCommandBufferStatistics = fn (cmd: CommandBufferId, stats: *CommandBufferStatistics) callconv(.C) void;
+
 pub const CmdBeginComputePass = fn (cmd: CommandBufferId, desc: *const ComputePassDescriptor) callconv(.C) ?ComputePassEncoderId;
 
 pub const ComputeEncoderBindDescriptorSet = fn (encoder: ComputePassEncoderId, set: DescriptorSetId, dynamic_offset_count: u32, p_dynamic_offsets: *const u32) callconv(.C) void;
@@ -857,6 +916,8 @@ pub const ComputeEncoderBindPipeline = fn (encoder: ComputePassEncoderId, pipeli
 
 pub const ComputeEncoderDispatch = fn (encoder: ComputePassEncoderId, x: u32, y: u32, z: u32) callconv(.C) void;
 
+pub const ComputeEncoderDispatchIndirect = fn (encoder: ComputePassEncoderId, buffer: BufferId, offset: u64) callconv(.C) void;
+
 pub const CmdEndComputePass = fn (cmd: CommandBufferId, encoder: ComputePassEncoderId) callconv(.C) void;
 
 pub const CmdBeginRenderPass = fn (cmd: CommandBufferId, begin_info: *const BeginRenderPassInfo) callconv(.C) ?RenderPassEncoderId;
@@ -879,6 +940,10 @@ pub const RenderEncoderPushConstants = fn (encoder: RenderPassEncoderId, rs: Roo
 
 pub const ComputeEncoderPushConstants = fn (encoder: ComputePassEncoderId, rs: RootSignatureId, name: ?[*:0]const u8, data: *const void) callconv(.C) void;
 
+pub const RenderEncoderPushConstantRange = fn (encoder: RenderPassEncoderId, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const void) callconv(.C) void;
+
+pub const ComputeEncoderPushConstantRange = fn (encoder: ComputePassEncoderId, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const void) callconv(.C) void;
+
 pub const RenderEncoderDraw = fn (encoder: RenderPassEncoderId, vertex_count: u32, first_vertex: u32) callconv(.C) void;
 
 pub const RenderEncoderDrawInstanced = fn (encoder: RenderPassEncoderId, vertex_count: u32, first_vertex: u32, instance_count: u32, first_instance: u32) callconv(.C) void;
@@ -887,6 +952,14 @@ pub const RenderEncoderDrawIndexed = fn (encoder: RenderPassEncoderId, index_cou
 
 pub const RenderEncoderDrawIndexedInstanced = fn (encoder: RenderPassEncoderId, index_count: u32, first_index: u32, instance_count: u32, first_instance: u32, first_vertex: u32) callconv(.C) void;
 
+pub const RenderEncoderDrawIndirect = fn (encoder: RenderPassEncoderId, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) callconv(.C) void;
+
+pub const RenderEncoderDrawIndexedIndirect = fn (encoder: RenderPassEncoderId, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) callconv(.C) void;
+
+pub const RenderEncoderDrawIndirectCount = fn (encoder: RenderPassEncoderId, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) callconv(.C) void;
+
+pub const RenderEncoderDrawIndexedIndirectCount = fn (encoder: RenderPassEncoderId, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) callconv(.C) void;
+
 pub const CmdEndRenderPass = fn (cmd: CommandBufferId, encoder: RenderPassEncoderId) callconv(.C) void;
 
 pub const CmdBeginEvent = fn (cmd: CommandBufferId, event: *const EventInfo) callconv(.C) void;
@@ -973,6 +1046,8 @@ pub const SemaphoreId = *Semaphore;
 
 pub const FenceId = *Fence;
 
+pub const TimelineSemaphoreId = *TimelineSemaphore;
+
 pub const CommandPoolId = *CommandPool;
 
 pub const CommandBufferId = *CommandBuffer;
@@ -1005,6 +1080,18 @@ pub const RootSignatureId = *RootSignature;
 
 pub const DescriptorSetId = *DescriptorSet;
 
+pub const DescriptorArenaId = *DescriptorArena;
+
+pub const DescriptorSetCacheId = *DescriptorSetCache;
+
+pub const CommandRingId = *CommandRing;
+
+pub const UploadRingId = *UploadRing;
+
+pub const UploadQueueId = *UploadQueue;
+
+pub const ReadbackRingId = *ReadbackRing;
+
 pub const ShaderReflectionId = *ShaderReflection;
 
 pub const CompiledShaderId = *CompiledShader;
@@ -1119,6 +1206,7 @@ pub const AdapterDetail = extern struct {
     dynamic_state_features: DynamicStateFeatures,
     support_host_visible_vram: bool,
     multidraw_indirect: bool,
+    support_draw_indirect_count: bool,
     support_geom_shader: bool,
     support_tessellation: bool,
     is_uma: bool,
@@ -1164,6 +1252,16 @@ pub const DeviceDescriptor = extern struct {
     disable_pipeline_cache: bool,
     queue_group_count: u32,
     p_queue_groups: [*]const QueueGroupDescriptor,
+    pipeline_cache_data_size: usize,
+    p_pipeline_cache_data: ?*const anyopaque = null,
+    bindless_texture_count: u32,
+    bindless_buffer_count: u32,
+};
+
+pub const DescriptorPoolStats = extern struct {
+    pool_count: u32,
+    max_sets: u32,
+    allocated_sets: u32,
 };
 
 pub const Device = extern struct {
@@ -1171,6 +1269,12 @@ pub const Device = extern struct {
     proc_table_cache: *const ProcTable,
     next_texture_id: u64,
     is_lost: bool,
+    pub inline fn getPipelineCacheData(self: *Device, size: usize, data: ?*anyopaque) usize {
+        return cgpu_device_get_pipeline_cache_data(self, size, data);
+    }
+    pub inline fn queryDescriptorPoolStats(self: *Device, stats: *DescriptorPoolStats) void {
+        return cgpu_device_query_descriptor_pool_stats(self, stats);
+    }
     pub inline fn queryVideoMemoryInfo(self: *Device, total: *u64, used_bytes: *u64) void {
         return cgpu_device_query_video_memory_info(self, total, used_bytes);
     }
@@ -1197,6 +1301,16 @@ pub const Device = extern struct {
     pub inline fn freeSemaphore(self: *Device, semaphore: SemaphoreId) void {
         return cgpu_device_free_semaphore(self, semaphore);
     }
+    pub inline fn createTimelineSemaphore(self: *Device, initial_value: u64) Error!TimelineSemaphoreId {
+        const result = cgpu_device_create_timeline_semaphore(self, initial_value);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeTimelineSemaphore(self: *Device, semaphore: TimelineSemaphoreId) void {
+        return cgpu_device_free_timeline_semaphore(self, semaphore);
+    }
     pub inline fn createRootSignaturePool(self: *Device, desc: *const RootSignaturePoolDescriptor) Error!RootSignaturePoolId {
         const result = cgpu_device_create_root_signature_pool(self, desc);
         return if (result) |result_object|
@@ -1227,6 +1341,81 @@ pub const Device = extern struct {
     pub inline fn freeDescriptorSet(self: *Device, set: DescriptorSetId) void {
         return cgpu_device_free_descriptor_set(self, set);
     }
+    pub inline fn createDescriptorArena(self: *Device, desc: *const DescriptorArenaDescriptor) Error!DescriptorArenaId {
+        const result = cgpu_device_create_descriptor_arena(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeDescriptorArena(self: *Device, arena: DescriptorArenaId) void {
+        return cgpu_device_free_descriptor_arena(self, arena);
+    }
+    pub inline fn createDescriptorSetCache(self: *Device, desc: *const DescriptorSetCacheDescriptor) Error!DescriptorSetCacheId {
+        const result = cgpu_device_create_descriptor_set_cache(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeDescriptorSetCache(self: *Device, cache: DescriptorSetCacheId) void {
+        return cgpu_device_free_descriptor_set_cache(self, cache);
+    }
+    pub inline fn createCommandRing(self: *Device, desc: *const CommandRingDescriptor) Error!CommandRingId {
+        const result = cgpu_device_create_command_ring(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeCommandRing(self: *Device, ring: CommandRingId) void {
+        return cgpu_device_free_command_ring(self, ring);
+    }
+    pub inline fn createUploadRing(self: *Device, desc: *const UploadRingDescriptor) Error!UploadRingId {
+        const result = cgpu_device_create_upload_ring(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeUploadRing(self: *Device, ring: UploadRingId) void {
+        return cgpu_device_free_upload_ring(self, ring);
+    }
+    pub inline fn createReadbackRing(self: *Device, desc: *const ReadbackRingDescriptor) Error!ReadbackRingId {
+        const result = cgpu_device_create_readback_ring(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeReadbackRing(self: *Device, ring: ReadbackRingId) void {
+        return cgpu_device_free_readback_ring(self, ring);
+    }
+    pub inline fn createUploadQueue(self: *Device, desc: *const UploadQueueDescriptor) Error!UploadQueueId {
+        const result = cgpu_device_create_upload_queue(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn freeUploadQueue(self: *Device, queue: UploadQueueId) void {
+        return cgpu_device_free_upload_queue(self, queue);
+    }
+    pub inline fn registerTextureView(self: *Device, view: TextureViewId) u32 {
+        return cgpu_device_register_texture_view(self, view);
+    }
+    pub inline fn registerBuffer(self: *Device, buffer: BufferId) u32 {
+        return cgpu_device_register_buffer(self, buffer);
+    }
+    pub inline fn unregisterTextureView(self: *Device, index: u32) void {
+        return cgpu_device_unregister_texture_view(self, index);
+    }
+    pub inline fn unregisterBuffer(self: *Device, index: u32) void {
+        return cgpu_device_unregister_buffer(self, index);
+    }
+    pub inline fn advanceBindlessFrame(self: *Device, fence: ?FenceId) void {
+        return cgpu_device_advance_bindless_frame(self, fence);
+    }
     pub inline fn createComputePipeline(self: *Device, desc: *const ComputePipelineDescriptor) Error!ComputePipelineId {
         const result = cgpu_device_create_compute_pipeline(self, desc);
         return if (result) |result_object|
@@ -1380,6 +1569,9 @@ pub const Queue = extern struct {
     pub inline fn submit(self: *Queue, desc: *const QueueSubmitDescriptor) SubmitError {
         return cgpu_queue_submit(self, desc);
     }
+    pub inline fn submitBatches(self: *Queue, batch_count: u32, p_descs: [*]const QueueSubmitDescriptor) SubmitError {
+        return cgpu_queue_submit_batches(self, batch_count, p_descs);
+    }
     pub inline fn present(self: *Queue, desc: *const QueuePresentDescriptor) PresentError {
         return cgpu_queue_present(self, desc);
     }
@@ -1424,6 +1616,17 @@ pub const Semaphore = extern struct {
     device: DeviceId,
 };
 
+pub const TimelineSemaphore = extern struct {
+    device: DeviceId,
+    emulated: bool,
+    pub inline fn signal(self: *TimelineSemaphore, value: u64) void {
+        return cgpu_timeline_semaphore_signal(self, value);
+    }
+    pub inline fn queryValue(self: *TimelineSemaphore) u64 {
+        return cgpu_timeline_semaphore_query_value(self);
+    }
+};
+
 pub const CommandPool = extern struct {
     queue: QueueId,
     pub inline fn createCommandBuffer(self: *CommandPool, desc: *const CommandBufferDescriptor) Error!CommandBufferId {
@@ -1448,6 +1651,16 @@ pub const CommandBuffer = extern struct {
     pub inline fn begin(self: *CommandBuffer) void {
         return cgpu_command_buffer_begin(self);
     }
+    pub inline fn beginSecondary(self: *CommandBuffer, inheritance: *const CommandBufferInheritanceInfo) Error!RenderPassEncoderId {
+        const result = cgpu_command_buffer_begin_secondary(self, inheritance);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn executeSecondaries(self: *CommandBuffer, count: u32, p_secondaries: [*]const CommandBufferId) void {
+        return cgpu_command_buffer_execute_secondaries(self, count, p_secondaries);
+    }
     pub inline fn transferBufferToBuffer(self: *CommandBuffer, desc: *const BufferToBufferTransfer) void {
         return cgpu_command_buffer_transfer_buffer_to_buffer(self, desc);
     }
@@ -1478,6 +1691,9 @@ pub const CommandBuffer = extern struct {
     pub inline fn end(self: *CommandBuffer) void {
         return cgpu_command_buffer_end(self);
     }
+    pub inline fn queryStatistics(self: *CommandBuffer, stats: *CommandBufferStatistics) void {
+        return cgpu_command_buffer_query_statistics(self, stats);
+    }
     pub inline fn beginComputePass(self: *CommandBuffer, desc: *const ComputePassDescriptor) Error!ComputePassEncoderId {
         const result = cgpu_command_buffer_begin_compute_pass(self, desc);
         return if (result) |result_object|
@@ -1545,9 +1761,15 @@ pub const ComputePassEncoder = extern struct {
     pub inline fn dispatch(self: *ComputePassEncoder, x: u32, y: u32, z: u32) void {
         return cgpu_compute_pass_encoder_dispatch(self, x, y, z);
     }
+    pub inline fn dispatchIndirect(self: *ComputePassEncoder, buffer: BufferId, offset: u64) void {
+        return cgpu_compute_pass_encoder_dispatch_indirect(self, buffer, offset);
+    }
     pub inline fn pushConstants(self: *ComputePassEncoder, rs: RootSignatureId, name: ?[*:0]const u8, data: *const anyopaque) void {
         return cgpu_compute_pass_encoder_push_constants(self, rs, name, data);
     }
+    pub inline fn pushConstantRange(self: *ComputePassEncoder, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const anyopaque) void {
+        return cgpu_compute_pass_encoder_push_constant_range(self, rs, slot, offset, size, data);
+    }
     pub inline fn bindStateBuffer(self: *ComputePassEncoder, stream: StateBufferId) void {
         return cgpu_compute_pass_encoder_bind_state_buffer(self, stream);
     }
@@ -1579,6 +1801,9 @@ pub const RenderPassEncoder = extern struct {
     pub inline fn pushConstants(self: *RenderPassEncoder, rs: RootSignatureId, name: ?[*:0]const u8, data: *const anyopaque) void {
         return cgpu_render_pass_encoder_push_constants(self, rs, name, data);
     }
+    pub inline fn pushConstantRange(self: *RenderPassEncoder, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const anyopaque) void {
+        return cgpu_render_pass_encoder_push_constant_range(self, rs, slot, offset, size, data);
+    }
     pub inline fn draw(self: *RenderPassEncoder, vertex_count: u32, first_vertex: u32) void {
         return cgpu_render_pass_encoder_draw(self, vertex_count, first_vertex);
     }
@@ -1591,6 +1816,18 @@ pub const RenderPassEncoder = extern struct {
     pub inline fn drawIndexedInstanced(self: *RenderPassEncoder, index_count: u32, first_index: u32, instance_count: u32, first_instance: u32, first_vertex: u32) void {
         return cgpu_render_pass_encoder_draw_indexed_instanced(self, index_count, first_index, instance_count, first_instance, first_vertex);
     }
+    pub inline fn drawIndirect(self: *RenderPassEncoder, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) void {
+        return cgpu_render_pass_encoder_draw_indirect(self, buffer, offset, draw_count, stride);
+    }
+    pub inline fn drawIndexedIndirect(self: *RenderPassEncoder, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) void {
+        return cgpu_render_pass_encoder_draw_indexed_indirect(self, buffer, offset, draw_count, stride);
+    }
+    pub inline fn drawIndirectCount(self: *RenderPassEncoder, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) void {
+        return cgpu_render_pass_encoder_draw_indirect_count(self, buffer, offset, count_buffer, count_buffer_offset, max_draw_count, stride);
+    }
+    pub inline fn drawIndexedIndirectCount(self: *RenderPassEncoder, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) void {
+        return cgpu_render_pass_encoder_draw_indexed_indirect_count(self, buffer, offset, count_buffer, count_buffer_offset, max_draw_count, stride);
+    }
     pub inline fn bindStateBuffer(self: *RenderPassEncoder, stream: StateBufferId) void {
         return cgpu_render_pass_encoder_bind_state_buffer(self, stream);
     }
@@ -1798,6 +2035,8 @@ pub const ParameterTable = extern struct {
     p_resources: [*]ShaderResource,
     dynamic_buffer_count: u32,
     set_index: u32,
+    hash_index_mask: u32,
+    p_hash_index: ?[*]u32 = null,
 };
 
 pub const RootSignature = extern struct {
@@ -1811,6 +2050,12 @@ pub const RootSignature = extern struct {
     pipeline_type: PipelineType,
     pool: RootSignaturePoolId,
     pool_sig: RootSignatureId,
+    pub inline fn resolveBinding(self: *const RootSignature, name: [*:0]const u8) u32 {
+        return cgpu_root_signature_resolve_binding(self, name);
+    }
+    pub inline fn resolvePushConstant(self: *const RootSignature, name: [*:0]const u8) u32 {
+        return cgpu_root_signature_resolve_push_constant(self, name);
+    }
     pub inline fn compileAndLinkShaders(self: *RootSignature, count: u32, desc: *const CompiledShaderDescriptor) Error!LinkedShaderId {
         const result = cgpu_root_signature_compile_and_link_shaders(self, count, desc);
         return if (result) |result_object|
@@ -1947,6 +2192,183 @@ pub const DescriptorSetDescriptor = extern struct {
     set_index: u32,
 };
 
+pub const DescriptorArenaDescriptor = extern struct {
+    max_sets_per_pool: u32,
+};
+
+pub const DescriptorArena = extern struct {
+    device: DeviceId,
+    pub inline fn allocateSet(self: *DescriptorArena, desc: *const DescriptorSetDescriptor) Error!DescriptorSetId {
+        const result = cgpu_descriptor_arena_allocate_set(self, desc);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn reset(self: *DescriptorArena) void {
+        return cgpu_descriptor_arena_reset(self);
+    }
+};
+
+pub const DescriptorSetCacheDescriptor = extern struct {
+    capacity: u32,
+};
+
+pub const DescriptorSetCache = extern struct {
+    device: DeviceId,
+    set_count: u32,
+    hit_count: u64,
+    miss_count: u64,
+    pub inline fn acquireSet(self: *DescriptorSetCache, desc: *const DescriptorSetDescriptor, data_count: u32, p_datas: [*]const DescriptorData) Error!DescriptorSetId {
+        const result = cgpu_descriptor_set_cache_acquire_set(self, desc, data_count, p_datas);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn advanceFrame(self: *DescriptorSetCache, fence: ?FenceId) void {
+        return cgpu_descriptor_set_cache_advance_frame(self, fence);
+    }
+    pub inline fn clear(self: *DescriptorSetCache) void {
+        return cgpu_descriptor_set_cache_clear(self);
+    }
+};
+
+pub const CommandRingDescriptor = extern struct {
+    queue: QueueId,
+    frame_count: u32,
+    thread_count: u32,
+};
+
+pub const CommandRing = extern struct {
+    device: DeviceId,
+    queue: QueueId,
+    frame_index: u64,
+    command_buffer_count: u32,
+    pub inline fn acquireCommandBuffer(self: *CommandRing, thread_index: u32, is_secondary: bool) Error!CommandBufferId {
+        const result = cgpu_command_ring_acquire_command_buffer(self, thread_index, is_secondary);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn advanceFrame(self: *CommandRing, fence: ?FenceId) void {
+        return cgpu_command_ring_advance_frame(self, fence);
+    }
+};
+
+pub const UploadRingDescriptor = extern struct {
+    size: u64,
+};
+
+pub const UploadRing = extern struct {
+    device: DeviceId,
+    buffer: ?BufferId = null,
+    capacity: u64,
+    used_bytes: u64,
+    pub inline fn allocate(self: *UploadRing, size: u64, alignment: u64, allocation: *UploadAllocation) bool {
+        return cgpu_upload_ring_allocate(self, size, alignment, allocation);
+    }
+    pub inline fn advanceFrame(self: *UploadRing, fence: ?FenceId) void {
+        return cgpu_upload_ring_advance_frame(self, fence);
+    }
+};
+
+pub const UploadAllocation = extern struct {
+    buffer: ?BufferId = null,
+    offset: u64,
+    size: u64,
+    cpu_address: ?*anyopaque = null,
+};
+
+pub const UploadQueueDescriptor = extern struct {
+    queue: QueueId,
+    consumer_queue: ?QueueId = null,
+    page_size: u64,
+};
+
+pub const UploadQueue = extern struct {
+    device: DeviceId,
+    queue: QueueId,
+    timeline: TimelineSemaphoreId,
+    submitted_token: u64,
+    pub inline fn uploadBuffer(self: *UploadQueue, desc: *const BufferUpload) u64 {
+        return cgpu_upload_queue_upload_buffer(self, desc);
+    }
+    pub inline fn uploadTexture(self: *UploadQueue, desc: *const TextureUpload) u64 {
+        return cgpu_upload_queue_upload_texture(self, desc);
+    }
+    pub inline fn flush(self: *UploadQueue) u64 {
+        return cgpu_upload_queue_flush(self);
+    }
+    pub inline fn isComplete(self: *UploadQueue, token: u64) bool {
+        return cgpu_upload_queue_is_complete(self, token);
+    }
+    pub inline fn wait(self: *UploadQueue, token: u64) void {
+        return cgpu_upload_queue_wait(self, token);
+    }
+    pub inline fn recordAcquireBarriers(self: *UploadQueue, cmd: CommandBufferId, token: u64) void {
+        return cgpu_upload_queue_record_acquire_barriers(self, cmd, token);
+    }
+};
+
+pub const BufferUpload = extern struct {
+    buffer: BufferId,
+    offset: u64,
+    data: *const anyopaque,
+    size: u64,
+    dst_state: ResourceState,
+};
+
+pub const TextureUpload = extern struct {
+    texture: TextureId,
+    mip_level: u32,
+    array_layer: u32,
+    data: *const anyopaque,
+    size: u64,
+    dst_state: ResourceState,
+};
+
+pub const ReadbackRingDescriptor = extern struct {
+    page_size: u64,
+};
+
+pub const ReadbackRing = extern struct {
+    device: DeviceId,
+    pending_count: u32,
+    pub inline fn readBuffer(self: *ReadbackRing, cmd: CommandBufferId, desc: *const BufferReadback) u64 {
+        return cgpu_readback_ring_read_buffer(self, cmd, desc);
+    }
+    pub inline fn advanceFrame(self: *ReadbackRing, fence: ?FenceId) void {
+        return cgpu_readback_ring_advance_frame(self, fence);
+    }
+    pub inline fn poll(self: *ReadbackRing) void {
+        return cgpu_readback_ring_poll(self);
+    }
+    pub inline fn isReady(self: *ReadbackRing, ticket: u64) bool {
+        return cgpu_readback_ring_is_ready(self, ticket);
+    }
+    pub inline fn map(self: *ReadbackRing, ticket: u64) Error!*const anyopaque {
+        const result = cgpu_readback_ring_map(self, ticket);
+        return if (result) |result_object|
+            result_object
+        else
+            Error.CreateFailed;
+    }
+    pub inline fn release(self: *ReadbackRing, ticket: u64) void {
+        return cgpu_readback_ring_release(self, ticket);
+    }
+};
+
+pub const BufferReadback = extern struct {
+    buffer: BufferId,
+    offset: u64,
+    size: u64,
+    src_state: ResourceState,
+    callback: ?*const ReadbackCallback = null,
+    user_data: ?*anyopaque = null,
+};
+
 pub const BufferParams = extern struct {
     offsets: [*]const u64,
     sizes: [*]const u64,
@@ -1980,6 +2402,7 @@ pub const DescriptorData = extern struct {
     params: DescriptorDataParams,
     resources: DescriptorDataResource,
     count: u32,
+    slot: u32,
 };
 
 pub const BufferInfo = extern struct {
@@ -1998,6 +2421,9 @@ pub const Buffer = extern struct {
     pub inline fn unmap(self: *Buffer) void {
         return cgpu_buffer_unmap(self);
     }
+    pub inline fn invalidate(self: *Buffer, range: ?*const BufferRange) void {
+        return cgpu_buffer_invalidate(self, range);
+    }
 };
 
 pub const TextureInfo = extern struct {
@@ -2107,6 +2533,16 @@ pub const MemoryPoolDescriptor = extern struct {
 pub const MemoryPool = extern struct {
     device: DeviceId,
     _type: MemoryPoolType,
+    pub inline fn queryStatistics(self: *MemoryPool, stats: *MemoryPoolStatistics) void {
+        return cgpu_memory_pool_query_statistics(self, stats);
+    }
+};
+
+pub const MemoryPoolStatistics = extern struct {
+    block_count: u32,
+    allocation_count: u32,
+    block_bytes: u64,
+    allocation_bytes: u64,
 };
 
 pub const QueueSubmitDescriptor = extern struct {
@@ -2115,8 +2551,16 @@ pub const QueueSubmitDescriptor = extern struct {
     signal_fence: FenceId,
     wait_semaphore_count: u32,
     p_wait_semaphores: [*]const SemaphoreId,
+    p_wait_stages: ?[*]const PipelineStage = null,
     signal_semaphore_count: u32,
     p_signal_semaphores: [*]const SemaphoreId,
+    wait_timeline_count: u32,
+    p_wait_timelines: ?[*]const TimelineSemaphoreId = null,
+    p_wait_timeline_values: ?[*]const u64 = null,
+    p_wait_timeline_stages: ?[*]const PipelineStage = null,
+    signal_timeline_count: u32,
+    p_signal_timelines: ?[*]const TimelineSemaphoreId = null,
+    p_signal_timeline_values: ?[*]const u64 = null,
 };
 
 pub const QueuePresentDescriptor = extern struct {
@@ -2195,6 +2639,27 @@ pub const PipelineReflection = extern struct {
     p_shader_resources: [*]const ShaderResource,
 };
 
+pub const DrawIndirectArguments = extern struct {
+    vertex_count: u32,
+    instance_count: u32,
+    first_vertex: u32,
+    first_instance: u32,
+};
+
+pub const DrawIndexedIndirectArguments = extern struct {
+    index_count: u32,
+    instance_count: u32,
+    first_index: u32,
+    vertex_offset: i32,
+    first_instance: u32,
+};
+
+pub const DispatchIndirectArguments = extern struct {
+    x: u32,
+    y: u32,
+    z: u32,
+};
+
 pub const ClearValue = extern struct {
     color: [4]f32,
     depth: f32,
@@ -2252,21 +2717,29 @@ pub const BufferBarrier = extern struct {
     buffer: BufferId,
     src_state: ResourceState,
     dst_state: ResourceState,
+    src_stage: PipelineStage,
+    dst_stage: PipelineStage,
     queue_acquire: u8,
     queue_release: u8,
     queue_type: QueueType,
+    offset: u64,
+    size: u64,
 };
 
 pub const TextureBarrier = extern struct {
     texture: TextureId,
     src_state: ResourceState,
     dst_state: ResourceState,
+    src_stage: PipelineStage,
+    dst_stage: PipelineStage,
     queue_acquire: u8,
     queue_release: u8,
     queue_type: QueueType,
     subresource_barrier: u8,
     mip_level: u8,
     array_layer: u16,
+    mip_count: u8,
+    array_layer_count: u16,
 };
 
 pub const ResourceBarrierDescriptor = extern struct {
@@ -2284,6 +2757,20 @@ pub const CommandBufferDescriptor = extern struct {
     is_secondary: bool,
 };
 
+pub const CommandBufferStatistics = extern struct {
+    elided_state_calls: u32,
+    emitted_state_calls: u32,
+    requested_barriers: u32,
+    emitted_barriers: u32,
+    emitted_barrier_calls: u32,
+};
+
+pub const CommandBufferInheritanceInfo = extern struct {
+    render_pass: ?RenderPassId = null,
+    subpass: u32,
+    framebuffer: ?FramebufferId = null,
+};
+
 pub const SwapChainDescriptor = extern struct {
     present_queue_count: u32,
     p_present_queues: [*]const QueueId,
@@ -2330,6 +2817,7 @@ pub const BufferDescriptor = extern struct {
     start_state: ResourceState,
     prefer_on_device: bool,
     prefer_on_host: bool,
+    memory_pool: ?MemoryPoolId = null,
 };
 
 pub const TextureDescriptor = extern struct {
@@ -2348,6 +2836,7 @@ pub const TextureDescriptor = extern struct {
     start_state: ResourceState,
     descriptors: ResourceType,
     is_restrict_dedicated: u32,
+    memory_pool: ?MemoryPoolId = null,
 };
 
 pub const ExportTextureDescriptor = extern struct {
@@ -2387,6 +2876,7 @@ pub const BeginRenderPassInfo = extern struct {
     framebuffer: FramebufferId,
     clear_value_count: u32,
     p_clear_values: ?[*]const ClearValue = null,
+    contents: RenderPassContents,
 };
 
 pub const EventInfo = extern struct {
@@ -2412,6 +2902,8 @@ pub const ProcTable = extern struct {
     query_queue_count: ?*const QueryQueueCount = null,
     create_device: ?*const CreateDevice = null,
     free_device: ?*const FreeDevice = null,
+    get_pipeline_cache_data: ?*const GetPipelineCacheData = null,
+    query_descriptor_pool_stats: ?*const QueryDescriptorPoolStats = null,
     create_fence: ?*const CreateFence = null,
     wait_fences: ?*const WaitFences = null,
     reset_fences: ?*const ResetFences = null,
@@ -2419,6 +2911,11 @@ pub const ProcTable = extern struct {
     free_fence: ?*const FreeFence = null,
     create_semaphore: ?*const CreateSemaphore = null,
     free_semaphore: ?*const FreeSemaphore = null,
+    create_timeline_semaphore: ?*const CreateTimelineSemaphore = null,
+    free_timeline_semaphore: ?*const FreeTimelineSemaphore = null,
+    signal_timeline_semaphore: ?*const SignalTimelineSemaphore = null,
+    wait_timeline_semaphores: ?*const WaitTimelineSemaphores = null,
+    query_timeline_semaphore_value: ?*const QueryTimelineSemaphoreValue = null,
     create_root_signature_pool: ?*const CreateRootSignaturePool = null,
     free_root_signature_pool: ?*const FreeRootSignaturePool = null,
     create_root_signature: ?*const CreateRootSignature = null,
@@ -2426,16 +2923,27 @@ pub const ProcTable = extern struct {
     create_descriptor_set: ?*const CreateDescriptorSet = null,
     free_descriptor_set: ?*const FreeDescriptorSet = null,
     update_descriptor_set: ?*const UpdateDescriptorSet = null,
+    create_descriptor_arena: ?*const CreateDescriptorArena = null,
+    descriptor_arena_allocate_set: ?*const DescriptorArenaAllocateSet = null,
+    reset_descriptor_arena: ?*const ResetDescriptorArena = null,
+    free_descriptor_arena: ?*const FreeDescriptorArena = null,
+    register_bindless_texture_view: ?*const RegisterBindlessTextureView = null,
+    register_bindless_buffer: ?*const RegisterBindlessBuffer = null,
+    unregister_bindless_texture_view: ?*const UnregisterBindlessTextureView = null,
+    unregister_bindless_buffer: ?*const UnregisterBindlessBuffer = null,
+    advance_bindless_frame: ?*const AdvanceBindlessFrame = null,
     create_compute_pipeline: ?*const CreateComputePipeline = null,
     free_compute_pipeline: ?*const FreeComputePipeline = null,
     create_render_pipeline: ?*const CreateRenderPipeline = null,
     free_render_pipeline: ?*const FreeRenderPipeline = null,
     create_memory_pool: ?*const CreateMemoryPool = null,
     free_memory_pool: ?*const FreeMemoryPool = null,
+    query_memory_pool_statistics: ?*const QueryMemoryPoolStatistics = null,
     create_query_pool: ?*const CreateQueryPool = null,
     free_query_pool: ?*const FreeQueryPool = null,
     get_queue: ?*const GetQueue = null,
     submit_queue: ?*const SubmitQueue = null,
+    submit_queue_batches: ?*const SubmitQueueBatches = null,
     wait_queue_idle: ?*const WaitQueueIdle = null,
     queue_present: ?*const QueuePresent = null,
     queue_get_timestamp_period: ?*const QueueGetTimestampPeriodNS = null,
@@ -2458,6 +2966,7 @@ pub const ProcTable = extern struct {
     create_buffer: ?*const CreateBuffer = null,
     map_buffer: ?*const MapBuffer = null,
     unmap_buffer: ?*const UnmapBuffer = null,
+    invalidate_buffer: ?*const InvalidateBuffer = null,
     free_buffer: ?*const FreeBuffer = null,
     create_sampler: ?*const CreateSampler = null,
     free_sampler: ?*const FreeSampler = null,
@@ -2472,6 +2981,8 @@ pub const ProcTable = extern struct {
     acquire_next_image: ?*const AcquireNextImage = null,
     free_swap_chain: ?*const FreeSwapChain = null,
     cmd_begin: ?*const CmdBegin = null,
+    cmd_begin_secondary: ?*const CmdBeginSecondary = null,
+    cmd_execute_secondaries: ?*const CmdExecuteSecondaries = null,
     cmd_transfer_buffer_to_buffer: ?*const CmdTransferBufferToBuffer = null,
     cmd_transfer_buffer_to_texture: ?*const CmdTransferBufferToTexture = null,
     cmd_transfer_buffer_to_tiles: ?*const CmdTransferBufferToTiles = null,
@@ -2482,11 +2993,14 @@ pub const ProcTable = extern struct {
     cmd_reset_query_pool: ?*const CmdResetQueryPool = null,
     cmd_resolve_query: ?*const CmdResolveQuery = null,
     cmd_end: ?*const CmdEnd = null,
+    query_command_buffer_statistics: ?*const QueryCommandBufferStatistics = null,
     cmd_begin_compute_pass: ?*const CmdBeginComputePass = null,
     compute_encoder_bind_descriptor_set: ?*const ComputeEncoderBindDescriptorSet = null,
     compute_encoder_push_constants: ?*const ComputeEncoderPushConstants = null,
+    compute_encoder_push_constant_range: ?*const ComputeEncoderPushConstantRange = null,
     compute_encoder_bind_pipeline: ?*const ComputeEncoderBindPipeline = null,
     compute_encoder_dispatch: ?*const ComputeEncoderDispatch = null,
+    compute_encoder_dispatch_indirect: ?*const ComputeEncoderDispatchIndirect = null,
     cmd_end_compute_pass: ?*const CmdEndComputePass = null,
     cmd_begin_render_pass: ?*const CmdBeginRenderPass = null,
     render_encoder_set_shading_rate: ?*const RenderEncoderSetShadingRate = null,
@@ -2495,12 +3009,17 @@ pub const ProcTable = extern struct {
     render_encoder_bind_vertex_buffers: ?*const RenderEncoderBindVertexBuffers = null,
     render_encoder_bind_index_buffer: ?*const RenderEncoderBindIndexBuffer = null,
     render_encoder_push_constants: ?*const RenderEncoderPushConstants = null,
+    render_encoder_push_constant_range: ?*const RenderEncoderPushConstantRange = null,
     render_encoder_set_viewport: ?*const RenderEncoderSetViewport = null,
     render_encoder_set_scissor: ?*const RenderEncoderSetScissor = null,
     render_encoder_draw: ?*const RenderEncoderDraw = null,
     render_encoder_draw_instanced: ?*const RenderEncoderDrawInstanced = null,
     render_encoder_draw_indexed: ?*const RenderEncoderDrawIndexed = null,
     render_encoder_draw_indexed_instanced: ?*const RenderEncoderDrawIndexedInstanced = null,
+    render_encoder_draw_indirect: ?*const RenderEncoderDrawIndirect = null,
+    render_encoder_draw_indexed_indirect: ?*const RenderEncoderDrawIndexedIndirect = null,
+    render_encoder_draw_indirect_count: ?*const RenderEncoderDrawIndirectCount = null,
+    render_encoder_draw_indexed_indirect_count: ?*const RenderEncoderDrawIndexedIndirectCount = null,
     cmd_end_render_pass: ?*const CmdEndRenderPass = null,
     cmd_begin_event: ?*const CmdBeginEvent = null,
     cmd_set_marker: ?*const CmdSetMarker = null,
@@ -2967,6 +3486,10 @@ extern fn cgpu_adapter_create_device(self: [*c]Adapter, desc: *const DeviceDescr
 
 extern fn cgpu_adapter_free_device(self: [*c]Adapter, device: DeviceId) void;
 
+extern fn cgpu_device_get_pipeline_cache_data(self: [*c]Device, size: usize, data: ?*anyopaque) usize;
+
+extern fn cgpu_device_query_descriptor_pool_stats(self: [*c]Device, stats: *DescriptorPoolStats) void;
+
 extern fn cgpu_device_query_video_memory_info(self: [*c]Device, total: *u64, used_bytes: *u64) void;
 
 extern fn cgpu_device_query_shared_memory_info(self: [*c]Device, total: *u64, used_bytes: *u64) void;
@@ -2979,6 +3502,19 @@ extern fn cgpu_device_create_semaphore(self: [*c]Device) ?SemaphoreId;
 
 extern fn cgpu_device_free_semaphore(self: [*c]Device, semaphore: SemaphoreId) void;
 
+extern fn cgpu_device_create_timeline_semaphore(self: [*c]Device, initial_value: u64) ?TimelineSemaphoreId;
+
+extern fn cgpu_device_free_timeline_semaphore(self: [*c]Device, semaphore: TimelineSemaphoreId) void;
+
+pub inline fn waitTimelineSemaphores(semaphore_count: u32, p_semaphores: [*]const TimelineSemaphoreId, p_values: [*]const u64, timeout_ns: u64) bool {
+    return cgpu_wait_timeline_semaphores(semaphore_count, p_semaphores, p_values, timeout_ns);
+}
+extern fn cgpu_wait_timeline_semaphores(semaphore_count: u32, p_semaphores: [*]const TimelineSemaphoreId, p_values: [*]const u64, timeout_ns: u64) bool;
+
+extern fn cgpu_timeline_semaphore_signal(self: [*c]TimelineSemaphore, value: u64) void;
+
+extern fn cgpu_timeline_semaphore_query_value(self: [*c]TimelineSemaphore) u64;
+
 extern fn cgpu_device_create_root_signature_pool(self: [*c]Device, desc: *const RootSignaturePoolDescriptor) ?RootSignaturePoolId;
 
 extern fn cgpu_device_free_root_signature_pool(self: [*c]Device, pool: RootSignaturePoolId) void;
@@ -2991,6 +3527,40 @@ extern fn cgpu_device_create_descriptor_set(self: [*c]Device, desc: *const Descr
 
 extern fn cgpu_device_free_descriptor_set(self: [*c]Device, set: DescriptorSetId) void;
 
+extern fn cgpu_device_create_descriptor_arena(self: [*c]Device, desc: *const DescriptorArenaDescriptor) ?DescriptorArenaId;
+
+extern fn cgpu_device_free_descriptor_arena(self: [*c]Device, arena: DescriptorArenaId) void;
+
+extern fn cgpu_device_create_descriptor_set_cache(self: [*c]Device, desc: *const DescriptorSetCacheDescriptor) ?DescriptorSetCacheId;
+
+extern fn cgpu_device_free_descriptor_set_cache(self: [*c]Device, cache: DescriptorSetCacheId) void;
+
+extern fn cgpu_device_create_command_ring(self: [*c]Device, desc: *const CommandRingDescriptor) ?CommandRingId;
+
+extern fn cgpu_device_free_command_ring(self: [*c]Device, ring: CommandRingId) void;
+
+extern fn cgpu_device_create_upload_ring(self: [*c]Device, desc: *const UploadRingDescriptor) ?UploadRingId;
+
+extern fn cgpu_device_free_upload_ring(self: [*c]Device, ring: UploadRingId) void;
+
+extern fn cgpu_device_create_readback_ring(self: [*c]Device, desc: *const ReadbackRingDescriptor) ?ReadbackRingId;
+
+extern fn cgpu_device_free_readback_ring(self: [*c]Device, ring: ReadbackRingId) void;
+
+extern fn cgpu_device_create_upload_queue(self: [*c]Device, desc: *const UploadQueueDescriptor) ?UploadQueueId;
+
+extern fn cgpu_device_free_upload_queue(self: [*c]Device, queue: UploadQueueId) void;
+
+extern fn cgpu_device_register_texture_view(self: [*c]Device, view: TextureViewId) u32;
+
+extern fn cgpu_device_register_buffer(self: [*c]Device, buffer: BufferId) u32;
+
+extern fn cgpu_device_unregister_texture_view(self: [*c]Device, index: u32) void;
+
+extern fn cgpu_device_unregister_buffer(self: [*c]Device, index: u32) void;
+
+extern fn cgpu_device_advance_bindless_frame(self: [*c]Device, fence: ?FenceId) void;
+
 extern fn cgpu_device_create_compute_pipeline(self: [*c]Device, desc: *const ComputePipelineDescriptor) ?ComputePipelineId;
 
 extern fn cgpu_device_free_compute_pipeline(self: [*c]Device, pipeline: ComputePipelineId) void;
@@ -3007,6 +3577,8 @@ extern fn cgpu_device_create_memory_pool(self: [*c]Device, desc: *const MemoryPo
 
 extern fn cgpu_device_free_memory_pool(self: [*c]Device, pool: MemoryPoolId) void;
 
+extern fn cgpu_memory_pool_query_statistics(self: [*c]MemoryPool, stats: *MemoryPoolStatistics) void;
+
 extern fn cgpu_device_get_queue(self: [*c]Device, _type: QueueType, index: u32) ?QueueId;
 
 extern fn cgpu_device_free_queue(self: [*c]Device, queue: QueueId) void;
@@ -3063,6 +3635,8 @@ extern fn cgpu_fence_query_status(self: [*c]Fence) FenceStatus;
 
 extern fn cgpu_queue_submit(self: [*c]Queue, desc: *const QueueSubmitDescriptor) SubmitError;
 
+extern fn cgpu_queue_submit_batches(self: [*c]Queue, batch_count: u32, p_descs: [*]const QueueSubmitDescriptor) SubmitError;
+
 extern fn cgpu_queue_present(self: [*c]Queue, desc: *const QueuePresentDescriptor) PresentError;
 
 extern fn cgpu_queue_wait_idle(self: [*c]Queue) void;
@@ -3081,8 +3655,54 @@ extern fn cgpu_queue_create_command_pool(self: [*c]Queue, desc: *const CommandPo
 
 extern fn cgpu_queue_free_command_pool(self: [*c]Queue, pool: CommandPoolId) void;
 
+extern fn cgpu_root_signature_resolve_binding(self: [*c]const RootSignature, name: [*:0]const u8) u32;
+
+extern fn cgpu_root_signature_resolve_push_constant(self: [*c]const RootSignature, name: [*:0]const u8) u32;
+
 extern fn cgpu_descriptor_set_update(self: [*c]DescriptorSet, data_count: u32, p_datas: [*]const DescriptorData) void;
 
+extern fn cgpu_descriptor_arena_allocate_set(self: [*c]DescriptorArena, desc: *const DescriptorSetDescriptor) ?DescriptorSetId;
+
+extern fn cgpu_descriptor_arena_reset(self: [*c]DescriptorArena) void;
+
+extern fn cgpu_descriptor_set_cache_acquire_set(self: [*c]DescriptorSetCache, desc: *const DescriptorSetDescriptor, data_count: u32, p_datas: [*]const DescriptorData) ?DescriptorSetId;
+
+extern fn cgpu_descriptor_set_cache_advance_frame(self: [*c]DescriptorSetCache, fence: ?FenceId) void;
+
+extern fn cgpu_descriptor_set_cache_clear(self: [*c]DescriptorSetCache) void;
+
+extern fn cgpu_command_ring_acquire_command_buffer(self: [*c]CommandRing, thread_index: u32, is_secondary: bool) ?CommandBufferId;
+
+extern fn cgpu_command_ring_advance_frame(self: [*c]CommandRing, fence: ?FenceId) void;
+
+extern fn cgpu_upload_ring_allocate(self: [*c]UploadRing, size: u64, alignment: u64, allocation: *UploadAllocation) bool;
+
+extern fn cgpu_upload_ring_advance_frame(self: [*c]UploadRing, fence: ?FenceId) void;
+
+extern fn cgpu_readback_ring_read_buffer(self: [*c]ReadbackRing, cmd: CommandBufferId, desc: *const BufferReadback) u64;
+
+extern fn cgpu_readback_ring_advance_frame(self: [*c]ReadbackRing, fence: ?FenceId) void;
+
+extern fn cgpu_readback_ring_poll(self: [*c]ReadbackRing) void;
+
+extern fn cgpu_readback_ring_is_ready(self: [*c]ReadbackRing, ticket: u64) bool;
+
+extern fn cgpu_readback_ring_map(self: [*c]ReadbackRing, ticket: u64) ?*const anyopaque;
+
+extern fn cgpu_readback_ring_release(self: [*c]ReadbackRing, ticket: u64) void;
+
+extern fn cgpu_upload_queue_upload_buffer(self: [*c]UploadQueue, desc: *const BufferUpload) u64;
+
+extern fn cgpu_upload_queue_upload_texture(self: [*c]UploadQueue, desc: *const TextureUpload) u64;
+
+extern fn cgpu_upload_queue_flush(self: [*c]UploadQueue) u64;
+
+extern fn cgpu_upload_queue_is_complete(self: [*c]UploadQueue, token: u64) bool;
+
+extern fn cgpu_upload_queue_wait(self: [*c]UploadQueue, token: u64) void;
+
+extern fn cgpu_upload_queue_record_acquire_barriers(self: [*c]UploadQueue, cmd: CommandBufferId, token: u64) void;
+
 extern fn cgpu_command_pool_create_command_buffer(self: [*c]CommandPool, desc: *const CommandBufferDescriptor) ?CommandBufferId;
 
 extern fn cgpu_command_pool_reset(self: [*c]CommandPool) void;
@@ -3093,10 +3713,16 @@ extern fn cgpu_buffer_map(self: [*c]Buffer, range: ?*const BufferRange) void;
 
 extern fn cgpu_buffer_unmap(self: [*c]Buffer) void;
 
+extern fn cgpu_buffer_invalidate(self: [*c]Buffer, range: ?*const BufferRange) void;
+
 extern fn cgpu_swap_chain_acquire_next_image(self: [*c]SwapChain, desc: *const AcquireNextDescriptor, p_image_index: *u32) AcquireNextImageError;
 
 extern fn cgpu_command_buffer_begin(self: [*c]CommandBuffer) void;
 
+extern fn cgpu_command_buffer_begin_secondary(self: [*c]CommandBuffer, inheritance: *const CommandBufferInheritanceInfo) ?RenderPassEncoderId;
+
+extern fn cgpu_command_buffer_execute_secondaries(self: [*c]CommandBuffer, count: u32, p_secondaries: [*]const CommandBufferId) void;
+
 extern fn cgpu_command_buffer_transfer_buffer_to_buffer(self: [*c]CommandBuffer, desc: *const BufferToBufferTransfer) void;
 
 extern fn cgpu_command_buffer_transfer_texture_to_texture(self: [*c]CommandBuffer, desc: *const TextureToTextureTransfer) void;
@@ -3117,6 +3743,8 @@ extern fn cgpu_command_buffer_resolve_query(self: [*c]CommandBuffer, pool: Query
 
 extern fn cgpu_command_buffer_end(self: [*c]CommandBuffer) void;
 
+extern fn cgpu_command_buffer_query_statistics(self: [*c]CommandBuffer, stats: *CommandBufferStatistics) void;
+
 extern fn cgpu_command_buffer_begin_compute_pass(self: [*c]CommandBuffer, desc: *const ComputePassDescriptor) ?ComputePassEncoderId;
 
 extern fn cgpu_command_buffer_end_compute_pass(self: [*c]CommandBuffer, encoder: ComputePassEncoderId) void;
@@ -3145,8 +3773,12 @@ extern fn cgpu_compute_pass_encoder_bind_compute_pipeline(self: [*c]ComputePassE
 
 extern fn cgpu_compute_pass_encoder_dispatch(self: [*c]ComputePassEncoder, x: u32, y: u32, z: u32) void;
 
+extern fn cgpu_compute_pass_encoder_dispatch_indirect(self: [*c]ComputePassEncoder, buffer: BufferId, offset: u64) void;
+
 extern fn cgpu_compute_pass_encoder_push_constants(self: [*c]ComputePassEncoder, rs: RootSignatureId, name: ?[*:0]const u8, data: *const anyopaque) void;
 
+extern fn cgpu_compute_pass_encoder_push_constant_range(self: [*c]ComputePassEncoder, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const anyopaque) void;
+
 extern fn cgpu_compute_pass_encoder_bind_state_buffer(self: [*c]ComputePassEncoder, stream: StateBufferId) void;
 
 extern fn cgpu_render_pass_encoder_set_shading_rate(self: [*c]RenderPassEncoder, shading_rate: ShadingRate, post_rasterize_rate: ShadingRateCombiner, final_rate: ShadingRateCombiner) void;
@@ -3165,6 +3797,8 @@ extern fn cgpu_render_pass_encoder_bind_index_buffer(self: [*c]RenderPassEncoder
 
 extern fn cgpu_render_pass_encoder_push_constants(self: [*c]RenderPassEncoder, rs: RootSignatureId, name: ?[*:0]const u8, data: *const anyopaque) void;
 
+extern fn cgpu_render_pass_encoder_push_constant_range(self: [*c]RenderPassEncoder, rs: RootSignatureId, slot: u32, offset: u32, size: u32, data: *const anyopaque) void;
+
 extern fn cgpu_render_pass_encoder_draw(self: [*c]RenderPassEncoder, vertex_count: u32, first_vertex: u32) void;
 
 extern fn cgpu_render_pass_encoder_draw_instanced(self: [*c]RenderPassEncoder, vertex_count: u32, first_vertex: u32, instance_count: u32, first_instance: u32) void;
@@ -3173,6 +3807,14 @@ extern fn cgpu_render_pass_encoder_draw_indexed(self: [*c]RenderPassEncoder, ind
 
 extern fn cgpu_render_pass_encoder_draw_indexed_instanced(self: [*c]RenderPassEncoder, index_count: u32, first_index: u32, instance_count: u32, first_instance: u32, first_vertex: u32) void;
 
+extern fn cgpu_render_pass_encoder_draw_indirect(self: [*c]RenderPassEncoder, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) void;
+
+extern fn cgpu_render_pass_encoder_draw_indexed_indirect(self: [*c]RenderPassEncoder, buffer: BufferId, offset: u64, draw_count: u32, stride: u32) void;
+
+extern fn cgpu_render_pass_encoder_draw_indirect_count(self: [*c]RenderPassEncoder, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) void;
+
+extern fn cgpu_render_pass_encoder_draw_indexed_indirect_count(self: [*c]RenderPassEncoder, buffer: BufferId, offset: u64, count_buffer: BufferId, count_buffer_offset: u64, max_draw_count: u32, stride: u32) void;
+
 extern fn cgpu_render_pass_encoder_bind_state_buffer(self: [*c]RenderPassEncoder, stream: StateBufferId) void;
 
 extern fn cgpu_root_signature_compile_and_link_shaders(self: [*c]RootSignature, count: u32, desc: *const CompiledShaderDescriptor) ?LinkedShaderId;
@@ -30,6 +30,11 @@ pub fn build(b: *std.Build) !void {
                 "common/cgpu.cpp",
                 "common/root_sig_pool.cpp",
                 "common/root_sig_table.cpp",
+                "common/descriptor_set_cache.cpp",
+                "common/command_ring.cpp",
+                "common/upload_ring.cpp",
+                "common/upload_queue.cpp",
+                "common/readback_ring.cpp",
             },
         },
     );
@@ -486,7 +486,7 @@ function converter.types(params)
 				";")
 		end
 	elseif typ.const_value then
-		yield("pub const " .. typ.name .. ": u32 = " .. tostring(typ.value) .. ";")
+		yield("pub const " .. typ.name .. ": " .. (typ.type and convert_type(typ.type) or "u32") .. " = " .. tostring(typ.value) .. ";")
 	elseif typ.cases then
 		local func_indent = "    "
 		yield(string.format("pub fn %s(arg: %s) %s {", typ.name, convert_type(typ.arg), convert_type(typ.ret)))
@@ -37,14 +37,18 @@ typedef struct CGPUSurfacesProcTable CGPUSurfacesProcTable;
 typedef struct CGPURuntimeTable CGPURuntimeTable;
 typedef struct CGPUAdapterDetail CGPUAdapterDetail;
 typedef struct CGPUDeviceDescriptor CGPUDeviceDescriptor;
+typedef struct CGPUDescriptorPoolStats CGPUDescriptorPoolStats;
+typedef struct CGPUCommandBufferStatistics CGPUCommandBufferStatistics;
 typedef struct CGPURootSignaturePoolDescriptor CGPURootSignaturePoolDescriptor;
 typedef struct CGPURootSignatureDescriptor CGPURootSignatureDescriptor;
 typedef struct CGPUDescriptorSetDescriptor CGPUDescriptorSetDescriptor;
+typedef struct CGPUDescriptorArenaDescriptor CGPUDescriptorArenaDescriptor;
 typedef struct CGPUDescriptorData CGPUDescriptorData;
 typedef struct CGPUComputePipelineDescriptor CGPUComputePipelineDescriptor;
 typedef struct CGPURenderPipelineDescriptor CGPURenderPipelineDescriptor;
 typedef struct CGPUQueryPoolDescriptor CGPUQueryPoolDescriptor;
 typedef struct CGPUMemoryPoolDescriptor CGPUMemoryPoolDescriptor;
+typedef struct CGPUMemoryPoolStatistics CGPUMemoryPoolStatistics;
 typedef struct CGPUQueueSubmitDescriptor CGPUQueueSubmitDescriptor;
 typedef struct CGPUQueuePresentDescriptor CGPUQueuePresentDescriptor;
 typedef struct CGPUTiledTextureRegions CGPUTiledTextureRegions;
@@ -53,6 +57,7 @@ typedef struct CGPURenderPassDescriptor CGPURenderPassDescriptor;
 typedef struct CGPUFramebufferDescriptor CGPUFramebufferDescriptor;
 typedef struct CGPUCommandPoolDescriptor CGPUCommandPoolDescriptor;
 typedef struct CGPUCommandBufferDescriptor CGPUCommandBufferDescriptor;
+typedef struct CGPUCommandBufferInheritanceInfo CGPUCommandBufferInheritanceInfo;
 typedef struct CGPUShaderLibraryDescriptor CGPUShaderLibraryDescriptor;
 typedef struct CGPUBufferDescriptor CGPUBufferDescriptor;
 typedef struct CGPUBufferRange CGPUBufferRange;
@@ -36,6 +36,8 @@ CGPU_API CGPUDeviceId cgpu_create_device_vulkan(CGPUAdapterId adapter, const CGP
 CGPU_API void cgpu_query_video_memory_info_vulkan(const CGPUDeviceId device, uint64_t* total, uint64_t* used_bytes);
 CGPU_API void cgpu_query_shared_memory_info_vulkan(const CGPUDeviceId device, uint64_t* total, uint64_t* used_bytes);
 CGPU_API void cgpu_free_device_vulkan(CGPUAdapterId adapter, CGPUDeviceId device);
+CGPU_API size_t cgpu_get_pipeline_cache_data_vulkan(CGPUDeviceId device, size_t size, void* data);
+CGPU_API void cgpu_query_descriptor_pool_stats_vulkan(CGPUDeviceId device, CGPUDescriptorPoolStats* stats);
 
 // API Object APIs
 CGPU_API CGPUFenceId cgpu_create_fence_vulkan(CGPUDeviceId device);
@@ -45,6 +47,11 @@ ECGPUFenceStatus cgpu_query_fence_status_vulkan(CGPUFenceId fence);
 CGPU_API void cgpu_free_fence_vulkan(CGPUDeviceId device, CGPUFenceId fence);
 CGPU_API CGPUSemaphoreId cgpu_create_semaphore_vulkan(CGPUDeviceId device);
 CGPU_API void cgpu_free_semaphore_vulkan(CGPUDeviceId device, CGPUSemaphoreId semaphore);
+CGPU_API CGPUTimelineSemaphoreId cgpu_create_timeline_semaphore_vulkan(CGPUDeviceId device, uint64_t initial_value);
+CGPU_API void cgpu_free_timeline_semaphore_vulkan(CGPUDeviceId device, CGPUTimelineSemaphoreId semaphore);
+CGPU_API void cgpu_signal_timeline_semaphore_vulkan(CGPUTimelineSemaphoreId semaphore, uint64_t value);
+CGPU_API bool cgpu_wait_timeline_semaphores_vulkan(uint32_t semaphore_count, const CGPUTimelineSemaphoreId* semaphores, const uint64_t* values, uint64_t timeout_ns);
+CGPU_API uint64_t cgpu_query_timeline_semaphore_value_vulkan(CGPUTimelineSemaphoreId semaphore);
 CGPU_API CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device, const struct CGPURootSignatureDescriptor* desc);
 CGPU_API void cgpu_free_root_signature_vulkan(CGPUDeviceId device, CGPURootSignatureId signature);
 CGPU_API CGPURootSignaturePoolId cgpu_create_root_signature_pool_vulkan(CGPUDeviceId device, const struct CGPURootSignaturePoolDescriptor* desc);
@@ -52,16 +59,29 @@ CGPU_API void cgpu_free_root_signature_pool_vulkan(CGPUDeviceId device, CGPURoot
 CGPU_API CGPUDescriptorSetId cgpu_create_descriptor_set_vulkan(CGPUDeviceId device, const struct CGPUDescriptorSetDescriptor* desc);
 CGPU_API void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count, const struct CGPUDescriptorData* datas);
 CGPU_API void cgpu_free_descriptor_set_vulkan(CGPUDeviceId device, CGPUDescriptorSetId set);
+CGPU_API CGPUDescriptorArenaId cgpu_create_descriptor_arena_vulkan(CGPUDeviceId device, const struct CGPUDescriptorArenaDescriptor* desc);
+CGPU_API CGPUDescriptorSetId cgpu_descriptor_arena_allocate_set_vulkan(CGPUDescriptorArenaId arena, const struct CGPUDescriptorSetDescriptor* desc);
+CGPU_API void cgpu_reset_descriptor_arena_vulkan(CGPUDescriptorArenaId arena);
+CGPU_API void cgpu_free_descriptor_arena_vulkan(CGPUDeviceId device, CGPUDescriptorArenaId arena);
+CGPU_API uint32_t cgpu_register_bindless_texture_view_vulkan(CGPUDeviceId device, CGPUTextureViewId view);
+CGPU_API uint32_t cgpu_register_bindless_buffer_vulkan(CGPUDeviceId device, CGPUBufferId buffer);
+CGPU_API void cgpu_unregister_bindless_texture_view_vulkan(CGPUDeviceId device, uint32_t index);
+CGPU_API void cgpu_unregister_bindless_buffer_vulkan(CGPUDeviceId device, uint32_t index);
+CGPU_API void cgpu_advance_bindless_frame_vulkan(CGPUDeviceId device, CGPUFenceId fence);
 CGPU_API CGPUComputePipelineId cgpu_create_compute_pipeline_vulkan(CGPUDeviceId device, const struct CGPUComputePipelineDescriptor* desc);
 CGPU_API void cgpu_free_compute_pipeline_vulkan(CGPUDeviceId device, CGPUComputePipelineId pipeline);
 CGPU_API CGPURenderPipelineId cgpu_create_render_pipeline_vulkan(CGPUDeviceId device, const struct CGPURenderPipelineDescriptor* desc);
 CGPU_API void cgpu_free_render_pipeline_vulkan(CGPUDeviceId device, CGPURenderPipelineId pipeline);
 CGPU_API CGPUQueryPoolId cgpu_create_query_pool_vulkan(CGPUDeviceId device, const struct CGPUQueryPoolDescriptor* desc);
 CGPU_API void cgpu_free_query_pool_vulkan(CGPUDeviceId device, CGPUQueryPoolId pool);
+CGPU_API CGPUMemoryPoolId cgpu_create_memory_pool_vulkan(CGPUDeviceId device, const struct CGPUMemoryPoolDescriptor* desc);
+CGPU_API void cgpu_free_memory_pool_vulkan(CGPUDeviceId device, CGPUMemoryPoolId pool);
+CGPU_API void cgpu_query_memory_pool_statistics_vulkan(CGPUMemoryPoolId pool, CGPUMemoryPoolStatistics* stats);
 
 // Queue APIs
 CGPU_API CGPUQueueId cgpu_get_queue_vulkan(CGPUDeviceId device, ECGPUQueueType type, uint32_t index);
 CGPU_API ECGPUSubmitError cgpu_submit_queue_vulkan(CGPUQueueId queue, const struct CGPUQueueSubmitDescriptor* desc);
+CGPU_API ECGPUSubmitError cgpu_submit_queue_batches_vulkan(CGPUQueueId queue, uint32_t batch_count, const struct CGPUQueueSubmitDescriptor* descs);
 CGPU_API void cgpu_wait_queue_idle_vulkan(CGPUQueueId queue);
 CGPU_API ECGPUPresentError cgpu_queue_present_vulkan(CGPUQueueId queue, const struct CGPUQueuePresentDescriptor* desc);
 CGPU_API float cgpu_queue_get_timestamp_period_ns_vulkan(CGPUQueueId queue);
@@ -91,6 +111,7 @@ CGPU_API void cgpu_free_shader_library_vulkan(CGPUDeviceId device, CGPUShaderLib
 CGPU_API CGPUBufferId cgpu_create_buffer_vulkan(CGPUDeviceId device, const struct CGPUBufferDescriptor* desc);
 CGPU_API void cgpu_map_buffer_vulkan(CGPUBufferId buffer, const struct CGPUBufferRange* range);
 CGPU_API void cgpu_unmap_buffer_vulkan(CGPUBufferId buffer);
+CGPU_API void cgpu_invalidate_buffer_vulkan(CGPUBufferId buffer, const struct CGPUBufferRange* range);
 CGPU_API void cgpu_free_buffer_vulkan(CGPUDeviceId device, CGPUBufferId buffer);
 
 // Sampler APIs
@@ -115,6 +136,8 @@ CGPU_API void cgpu_free_swapchain_vulkan(CGPUDeviceId device, CGPUSwapChainId sw
 
 // CMDs
 CGPU_API void cgpu_cmd_begin_vulkan(CGPUCommandBufferId cmd);
+CGPU_API CGPURenderPassEncoderId cgpu_cmd_begin_secondary_vulkan(CGPUCommandBufferId cmd, const struct CGPUCommandBufferInheritanceInfo* inheritance);
+CGPU_API void cgpu_cmd_execute_secondaries_vulkan(CGPUCommandBufferId cmd, uint32_t count, const CGPUCommandBufferId* secondaries);
 CGPU_API void cgpu_cmd_transfer_buffer_to_buffer_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToBufferTransfer* desc);
 CGPU_API void cgpu_cmd_transfer_buffer_to_texture_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToTextureTransfer* desc);
 CGPU_API void cgpu_cmd_transfer_buffer_to_tiles_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToTilesTransfer* desc);
@@ -125,6 +148,7 @@ CGPU_API void cgpu_cmd_end_query_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId
 CGPU_API void cgpu_cmd_reset_query_pool_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId, uint32_t start_query, uint32_t query_count);
 CGPU_API void cgpu_cmd_resolve_query_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId pool, CGPUBufferId readback, uint32_t start_query, uint32_t query_count);
 CGPU_API void cgpu_cmd_end_vulkan(CGPUCommandBufferId cmd);
+CGPU_API void cgpu_query_command_buffer_statistics_vulkan(CGPUCommandBufferId cmd, CGPUCommandBufferStatistics* stats);
 
 // Events
 CGPU_API void cgpu_cmd_begin_event_vulkan(CGPUCommandBufferId cmd, const CGPUEventInfo* event);
@@ -135,8 +159,10 @@ CGPU_API void cgpu_cmd_end_event_vulkan(CGPUCommandBufferId cmd);
 CGPU_API CGPUComputePassEncoderId cgpu_cmd_begin_compute_pass_vulkan(CGPUCommandBufferId cmd, const struct CGPUComputePassDescriptor* desc);
 CGPU_API void cgpu_compute_encoder_bind_descriptor_set_vulkan(CGPUComputePassEncoderId encoder, CGPUDescriptorSetId descriptor, uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
 CGPU_API void cgpu_compute_encoder_push_constants_vulkan(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data);
+CGPU_API void cgpu_compute_encoder_push_constant_range_vulkan(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
 CGPU_API void cgpu_compute_encoder_bind_pipeline_vulkan(CGPUComputePassEncoderId encoder, CGPUComputePipelineId pipeline);
 CGPU_API void cgpu_compute_encoder_dispatch_vulkan(CGPUComputePassEncoderId encoder, uint32_t X, uint32_t Y, uint32_t Z);
+CGPU_API void cgpu_compute_encoder_dispatch_indirect_vulkan(CGPUComputePassEncoderId encoder, CGPUBufferId buffer, uint64_t offset);
 CGPU_API void cgpu_cmd_end_compute_pass_vulkan(CGPUCommandBufferId cmd, CGPUComputePassEncoderId encoder);
 
 // Render CMDs
@@ -150,10 +176,15 @@ CGPU_API void cgpu_render_encoder_bind_vertex_buffers_vulkan(CGPURenderPassEncod
 const CGPUBufferId* buffers, const uint32_t* strides, const uint32_t* offsets);
 CGPU_API void cgpu_render_encoder_bind_index_buffer_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint32_t index_stride, uint64_t offset);
 CGPU_API void cgpu_render_encoder_push_constants_vulkan(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data);
+CGPU_API void cgpu_render_encoder_push_constant_range_vulkan(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
 CGPU_API void cgpu_render_encoder_draw_vulkan(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex);
 CGPU_API void cgpu_render_encoder_draw_instanced_vulkan(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex, uint32_t instance_count, uint32_t first_instance);
 CGPU_API void cgpu_render_encoder_draw_indexed_vulkan(CGPURenderPassEncoderId encoder, uint32_t index_count, uint32_t first_index, uint32_t first_vertex);
 CGPU_API void cgpu_render_encoder_draw_indexed_instanced_vulkan(CGPURenderPassEncoderId encoder, uint32_t index_count, uint32_t first_index, uint32_t instance_count, uint32_t first_instance, uint32_t first_vertex);
+CGPU_API void cgpu_render_encoder_draw_indirect_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+CGPU_API void cgpu_render_encoder_draw_indexed_indirect_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+CGPU_API void cgpu_render_encoder_draw_indirect_count_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
+CGPU_API void cgpu_render_encoder_draw_indexed_indirect_count_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
 CGPU_API void cgpu_cmd_end_render_pass_vulkan(CGPUCommandBufferId cmd, CGPURenderPassEncoderId encoder);
 
 typedef struct CGPUInstance_Vulkan {
@@ -218,9 +249,19 @@ typedef struct CGPUAdapter_Vulkan {
 #if VK_KHR_buffer_device_address
     VkPhysicalDeviceBufferDeviceAddressFeaturesKHR mPhysicalDeviceBufferDeviceAddressFeatures;
 #endif
+#if VK_KHR_timeline_semaphore
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mPhysicalDeviceTimelineSemaphoreFeatures;
+#endif
+#if VK_KHR_synchronization2
+    VkPhysicalDeviceSynchronization2FeaturesKHR mPhysicalDeviceSynchronization2Features;
+#endif
 #if VK_EXT_descriptor_buffer
     VkPhysicalDeviceDescriptorBufferFeaturesEXT mPhysicalDeviceDescriptorBufferFeatures;
     VkPhysicalDeviceDescriptorBufferPropertiesEXT mPhysicalDeviceDescriptorBufferProperties;
+#endif
+#if VK_EXT_descriptor_indexing
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT mPhysicalDeviceDescriptorIndexingFeatures;
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT mPhysicalDeviceDescriptorIndexingProperties;
 #endif
     VkPhysicalDeviceFeatures2 mPhysicalDeviceFeatures;
     VkPhysicalDeviceSubgroupProperties mSubgroupProperties;
@@ -256,6 +297,10 @@ typedef struct CGPUAdapter_Vulkan {
     uint32_t descriptor_buffer : 1;
     uint32_t descriptor_indexing : 1;
     uint32_t sampler_ycbcr : 1;
+    // Extension or core 1.2 with the feature enabled, timelines are emulated otherwise
+    uint32_t timeline_semaphore : 1;
+    // Extension or core 1.3 with the feature enabled, barriers carry per-barrier stages then
+    uint32_t synchronization2 : 1;
 #ifdef ENABLE_NSIGHT_AFTERMATH
     uint32_t nv_diagnostic_checkpoints : 1;
     uint32_t nv_diagnostic_config : 1;
@@ -263,11 +308,25 @@ typedef struct CGPUAdapter_Vulkan {
     CGPUAdapterDetail adapter_detail;
 } CGPUAdapter_Vulkan;
 
+// Descriptor set allocations are spread over per-thread pool shards
+#define CGPU_VK_DESCRIPTOR_POOL_SHARD_COUNT 16
+// 64 dwords, covers the whole maxPushConstantsSize of most implementations
+#define CGPU_VK_PUSH_CONSTANT_SHADOW_SIZE 256
+// Bound state tracked by command buffers to elide no-op binds, slots beyond are always emitted
+#define CGPU_VK_SHADOWED_SET_COUNT 8
+#define CGPU_VK_SHADOWED_VERTEX_BUFFER_COUNT 16
+#define CGPU_VK_SHADOWED_BIND_POINT_COUNT 2
+// Resource classes of the bindless heap, one descriptor set each
+#define CGPU_VK_BINDLESS_TEXTURES 0
+#define CGPU_VK_BINDLESS_BUFFERS 1
+#define CGPU_VK_BINDLESS_CLASS_COUNT 2
+
 typedef struct CGPUDevice_Vulkan {
     CGPUDevice super;
     VkDevice pVkDevice;
     VkPipelineCache pPipelineCache;
-    struct VkUtil_DescriptorPool* pDescriptorPool;
+    // Shard 0 is created with the device, others lazily on first use by a thread
+    struct VkUtil_DescriptorPool* pDescriptorPools[CGPU_VK_DESCRIPTOR_POOL_SHARD_COUNT];
     struct VmaAllocator_T* pVmaAllocator;
     struct VmaPool_T* pExternalMemoryVmaPools[VK_MAX_MEMORY_TYPES];
     void* pExternalMemoryVmaPoolNexts[VK_MAX_MEMORY_TYPES];
@@ -278,6 +337,13 @@ typedef struct CGPUDevice_Vulkan {
     // Used to fill set slots that are never referenced by the shader (numbering gaps).
     VkDescriptorSetLayout pEmptySetLayout;
     VkDescriptorSet pEmptyDescSet;
+    VkDescriptorPool pEmptyDescPool;
+    // Null unless bindless heap capacities are requested and descriptor indexing is supported
+    struct VkUtil_BindlessHeap* pBindlessHeap;
+    // Null unless VK_EXT_descriptor_buffer is usable, eligible root signatures place their sets in it
+    struct VkUtil_DescriptorBuffer* pDescriptorBuffer;
+    // Empty layout for numbering gaps of root signatures on the descriptor buffer path
+    VkDescriptorSetLayout pEmptyDescriptorBufferSetLayout;
 } CGPUDevice_Vulkan;
 
 typedef struct CGPUFence_Vulkan {
@@ -292,6 +358,14 @@ typedef struct CGPUSemaphore_Vulkan {
     uint8_t mSignaled : 1;
 } CGPUSemaphore_Vulkan;
 
+typedef struct CGPUTimelineSemaphore_Vulkan {
+    CGPUTimelineSemaphore super;
+    /// VK_NULL_HANDLE when emulated
+    VkSemaphore pVkSemaphore;
+    /// Null unless emulated
+    struct VkUtil_EmulatedTimeline* pEmulated;
+} CGPUTimelineSemaphore_Vulkan;
+
 typedef struct CGPUQueue_Vulkan {
     const CGPUQueue super;
     VkQueue pVkQueue;
@@ -300,6 +374,13 @@ typedef struct CGPUQueue_Vulkan {
     CGPUCommandPoolId pInnerCmdPool;
     CGPUCommandBufferId pInnerCmdBuffer;
     CGPUFenceId pInnerFence;
+    /// Initial state transitions of resources owned by this queue, recorded ahead of the next submit
+    CGPUBufferBarrier* pPendingBufferInits;
+    uint32_t mPendingBufferInitCount;
+    uint32_t mPendingBufferInitCapacity;
+    CGPUTextureBarrier* pPendingTextureInits;
+    uint32_t mPendingTextureInitCount;
+    uint32_t mPendingTextureInitCapacity;
     /// Lock for multi-threaded descriptor allocations
     struct SMutex* pMutex;
 } CGPUQueue_Vulkan;
@@ -315,6 +396,12 @@ typedef struct CGPUQueryPool_Vulkan {
     VkQueryType mType;
 } CGPUQueryPool_Vulkan;
 
+typedef struct CGPUMemoryPool_Vulkan {
+    CGPUMemoryPool super;
+    struct VmaPool_T* pVmaPool;
+    uint32_t mMemoryTypeIndex;
+} CGPUMemoryPool_Vulkan;
+
 typedef struct CGPURenderPass_Vulkan {
     CGPURenderPass super;
     VkRenderPass pVkRenderPass;
@@ -325,12 +412,61 @@ typedef struct CGPUFramebuffer_Vulkan {
     VkFramebuffer pVkFramebuffer;
 } CGPUFramebuffer_Vulkan;
 
+typedef struct BindPointState_Vulkan {
+    VkPipeline pPipeline;
+    // Sets are only valid for the layout they were bound with
+    VkPipelineLayout pSetLayout;
+    VkDescriptorSet pSets[CGPU_VK_SHADOWED_SET_COUNT];
+} BindPointState_Vulkan;
+
+// Barriers queued since the last flush, arrays grow and are kept across recordings
+typedef struct PendingBarriers_Vulkan {
+    VkBufferMemoryBarrier* pBufferBarriers;
+    VkPipelineStageFlags* pBufferSrcStages;
+    VkPipelineStageFlags* pBufferDstStages;
+    ECGPUResourceStateFlags* pBufferDstStates;
+    uint32_t mBufferCount;
+    uint32_t mBufferCapacity;
+    VkImageMemoryBarrier* pImageBarriers;
+    VkPipelineStageFlags* pImageSrcStages;
+    VkPipelineStageFlags* pImageDstStages;
+    ECGPUResourceStateFlags* pImageDstStates;
+    uint32_t mImageCount;
+    uint32_t mImageCapacity;
+} PendingBarriers_Vulkan;
+
 typedef struct CGPUCommandBuffer_Vulkan {
     CGPUCommandBuffer super;
     VkCommandBuffer pVkCmdBuf;
     VkPipelineLayout pBoundPipelineLayout;
     VkRenderPass pRenderPass;
     uint32_t mType : 3;
+    uint32_t mSecondary : 1;
+    // The device descriptor buffer is bound once per recording
+    uint32_t mDescriptorBufferBound : 1;
+    // Last pushed constants, one valid bit per dword, reset when the layout changes
+    VkPipelineLayout pPushConstantLayout;
+    uint64_t mPushConstantValidMask;
+    uint8_t mPushConstantShadow[CGPU_VK_PUSH_CONSTANT_SHADOW_SIZE];
+    // Shadow of bound state, graphics then compute
+    BindPointState_Vulkan mBindPoints[CGPU_VK_SHADOWED_BIND_POINT_COUNT];
+    VkBuffer pVertexBuffers[CGPU_VK_SHADOWED_VERTEX_BUFFER_COUNT];
+    VkDeviceSize mVertexBufferOffsets[CGPU_VK_SHADOWED_VERTEX_BUFFER_COUNT];
+    VkBuffer pIndexBuffer;
+    VkDeviceSize mIndexBufferOffset;
+    VkIndexType mIndexType;
+    VkViewport mViewport;
+    VkRect2D mScissor;
+    uint32_t mViewportValid : 1;
+    uint32_t mScissorValid : 1;
+    // Flushed into one barrier call before the next command that may depend on them
+    PendingBarriers_Vulkan mPendingBarriers;
+    // Profiling counters of the current recording, reset at cmd_begin
+    uint32_t mElidedStateCalls;
+    uint32_t mEmittedStateCalls;
+    uint32_t mRequestedBarriers;
+    uint32_t mEmittedBarriers;
+    uint32_t mEmittedBarrierCalls;
 } CGPUCommandBuffer_Vulkan;
 
 typedef struct CGPUBuffer_Vulkan {
@@ -340,6 +476,12 @@ typedef struct CGPUBuffer_Vulkan {
     VkBufferView pVkUniformTexelView;
     struct VmaAllocation_T* pVkAllocation;
     uint64_t mOffset;
+    // Only queried on the descriptor buffer path
+    VkDeviceAddress mDeviceAddress;
+    /// Owner queue that transitions the start state, set once at creation
+    struct CGPUQueue_Vulkan* pInitQueue;
+    /// The transition is not submitted yet, guarded by the owner queue lock
+    bool mInitPending;
 } CGPUBuffer_Vulkan;
 
 typedef struct CGPUTileMapping_Vulkan
@@ -379,6 +521,10 @@ typedef struct CGPUTexture_Vulkan {
             bool mSingleTail;
         };
     };
+    /// Owner queue that transitions the start state, set once at creation
+    struct CGPUQueue_Vulkan* pInitQueue;
+    /// The transition is not submitted yet, guarded by the owner queue lock
+    bool mInitPending;
 } CGPUTexture_Vulkan;
 
 typedef struct CGPUTextureView_Vulkan {
@@ -410,11 +556,19 @@ typedef struct CGPUSwapChain_Vulkan {
     VkSwapchainKHR pVkSwapChain;
 } CGPUSwapChain_Vulkan;
 
+#define CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE (VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1)
 typedef struct SetLayout_Vulkan {
     VkDescriptorSetLayout layout;
     VkDescriptorUpdateTemplate pUpdateTemplate;
     uint32_t mUpdateEntriesCount;
     uint32_t dynamic_count;
+    // Descriptors per VkDescriptorType consumed by one set of this layout
+    uint32_t mDescriptorCounts[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE];
+    // Heap set auto-bound with the pipeline if this set slot is backed by the bindless heap
+    VkDescriptorSet pBindlessSet;
+    // Descriptor buffer path: set size and binding offsets, indexed like the table resources
+    VkDeviceSize mDescriptorBufferSize;
+    VkDeviceSize* pDescriptorBufferOffsets;
 } SetLayout_Vulkan;
 
 typedef struct CGPURootSignature_Vulkan {
@@ -425,6 +579,10 @@ typedef struct CGPURootSignature_Vulkan {
     uint32_t mSetLayoutCount;
     // Bit i set: set slot i is a numbering gap never referenced by the shader.
     uint32_t empty_set_mask;
+    // Bit i set: set slot i uses a layout owned by the device bindless heap.
+    uint32_t bindless_set_mask;
+    // Sets live in the device descriptor buffer instead of VkDescriptorSet objects
+    uint32_t use_descriptor_buffer : 1;
     VkPushConstantRange* pPushConstRanges;
 } CGPURootSignature_Vulkan;
 
@@ -449,9 +607,34 @@ typedef union VkDescriptorUpdateData
 typedef struct CGPUDescriptorSet_Vulkan {
     CGPUDescriptorSet super;
     VkDescriptorSet pVkDescriptorSet;
+    // Owner shard and block of the device descriptor pool the set was allocated from
+    struct VkUtil_DescriptorPool* pDescriptorPool;
+    VkDescriptorPool pVkDescriptorPool;
     union VkDescriptorUpdateData* pUpdateData;
+    // Descriptor buffer path: virtual allocation and offset of the set in the device descriptor buffer
+    uint64_t mDescriptorBufferAllocation;
+    VkDeviceSize mDescriptorBufferOffset;
+    // Allocated from a descriptor arena, released by arena reset only
+    uint32_t mTransient : 1;
 } CGPUDescriptorSet_Vulkan;
 
+typedef struct CGPUDescriptorArena_Vulkan {
+    CGPUDescriptorArena super;
+    VkDescriptorPool* pVkDescPools;
+    uint32_t mPoolCount;
+    uint32_t mPoolCapacity;
+    // Pool serving bump allocations, pools before it are exhausted
+    uint32_t mCurrentPool;
+    uint32_t mMaxSetsPerPool;
+    // Host memory of the set objects, rewound on reset
+    struct VkUtil_ArenaHostBlock* pHostBlocks;
+    struct VkUtil_ArenaHostBlock* pCurrentHostBlock;
+    // Descriptor buffer ranges of sets on the descriptor buffer path, freed on reset
+    uint64_t* pDescriptorBufferAllocations;
+    uint32_t mDescriptorBufferAllocationCount;
+    uint32_t mDescriptorBufferAllocationCapacity;
+} CGPUDescriptorArena_Vulkan;
+
 typedef struct CGPUComputePipeline_Vulkan {
     CGPUComputePipeline super;
     VkPipeline pVkPipeline;
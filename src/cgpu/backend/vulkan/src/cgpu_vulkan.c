@@ -250,6 +250,129 @@ void cgpu_free_semaphore_vulkan(CGPUDeviceId device, CGPUSemaphoreId semaphore)
     cgpu_free(allocator, Semaphore);
 }
 
+CGPUTimelineSemaphoreId cgpu_create_timeline_semaphore_vulkan(CGPUDeviceId device, uint64_t initial_value)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    CGPUTimelineSemaphore_Vulkan* Semaphore = cgpu_calloc(allocator, 1, sizeof(CGPUTimelineSemaphore_Vulkan));
+#if VK_KHR_timeline_semaphore
+    if (A->timeline_semaphore)
+    {
+        VkSemaphoreTypeCreateInfoKHR type_info = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+            .pNext = NULL,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+            .initialValue = initial_value
+        };
+        VkSemaphoreCreateInfo semaphore_info = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &type_info,
+            .flags = 0
+        };
+        if (D->mVkDeviceTable.vkCreateSemaphore(D->pVkDevice, &semaphore_info, &I->vkAllocator, &Semaphore->pVkSemaphore) != VK_SUCCESS)
+        {
+            cgpu_error(&I->super.logger, "Failed to create timeline semaphore!\n");
+            cgpu_free(allocator, Semaphore);
+            return CGPU_NULLPTR;
+        }
+        return &Semaphore->super;
+    }
+#endif
+    Semaphore->pEmulated = VkUtil_CreateEmulatedTimeline(D, initial_value);
+    Semaphore->super.emulated = true;
+    return &Semaphore->super;
+}
+
+void cgpu_free_timeline_semaphore_vulkan(CGPUDeviceId device, CGPUTimelineSemaphoreId semaphore)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)semaphore->device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    CGPUTimelineSemaphore_Vulkan* Semaphore = (CGPUTimelineSemaphore_Vulkan*)semaphore;
+    if (Semaphore->pEmulated)
+        VkUtil_FreeEmulatedTimeline(Semaphore->pEmulated);
+    else
+        D->mVkDeviceTable.vkDestroySemaphore(D->pVkDevice, Semaphore->pVkSemaphore, &I->vkAllocator);
+    cgpu_free(allocator, Semaphore);
+}
+
+void cgpu_signal_timeline_semaphore_vulkan(CGPUTimelineSemaphoreId semaphore, uint64_t value)
+{
+    CGPUTimelineSemaphore_Vulkan* Semaphore = (CGPUTimelineSemaphore_Vulkan*)semaphore;
+    if (Semaphore->pEmulated)
+    {
+        VkUtil_EmulatedTimelineSignal(Semaphore->pEmulated, value);
+        return;
+    }
+#if VK_KHR_timeline_semaphore
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)semaphore->device;
+    VkSemaphoreSignalInfoKHR signal_info = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR,
+        .pNext = NULL,
+        .semaphore = Semaphore->pVkSemaphore,
+        .value = value
+    };
+    PFN_vkSignalSemaphoreKHR pfnSignalSemaphore = D->mVkDeviceTable.vkSignalSemaphore ?
+        D->mVkDeviceTable.vkSignalSemaphore : D->mVkDeviceTable.vkSignalSemaphoreKHR;
+    CHECK_VKRESULT(&D->super.adapter->instance->logger, pfnSignalSemaphore(D->pVkDevice, &signal_info));
+#endif
+}
+
+// A device either supports timelines or emulates all of them, so semaphores are never mixed.
+// Emulated waits are sequential and the timeout applies to each of them.
+bool cgpu_wait_timeline_semaphores_vulkan(uint32_t semaphore_count, const CGPUTimelineSemaphoreId* semaphores, const uint64_t* values, uint64_t timeout_ns)
+{
+    if (semaphores[0]->emulated)
+    {
+        for (uint32_t i = 0; i < semaphore_count; ++i)
+        {
+            CGPUTimelineSemaphore_Vulkan* Semaphore = (CGPUTimelineSemaphore_Vulkan*)semaphores[i];
+            if (!VkUtil_EmulatedTimelineWait(Semaphore->pEmulated, values[i], timeout_ns))
+                return false;
+        }
+        return true;
+    }
+#if VK_KHR_timeline_semaphore
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)semaphores[0]->device;
+    CGPU_DECLARE_ZERO_VLA(VkSemaphore, vk_semaphores, semaphore_count)
+    for (uint32_t i = 0; i < semaphore_count; ++i)
+    {
+        vk_semaphores[i] = ((CGPUTimelineSemaphore_Vulkan*)semaphores[i])->pVkSemaphore;
+    }
+    VkSemaphoreWaitInfoKHR wait_info = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+        .pNext = NULL,
+        .flags = 0,
+        .semaphoreCount = semaphore_count,
+        .pSemaphores = vk_semaphores,
+        .pValues = values
+    };
+    PFN_vkWaitSemaphoresKHR pfnWaitSemaphores = D->mVkDeviceTable.vkWaitSemaphores ?
+        D->mVkDeviceTable.vkWaitSemaphores : D->mVkDeviceTable.vkWaitSemaphoresKHR;
+    return pfnWaitSemaphores(D->pVkDevice, &wait_info, timeout_ns) == VK_SUCCESS;
+#else
+    return false;
+#endif
+}
+
+uint64_t cgpu_query_timeline_semaphore_value_vulkan(CGPUTimelineSemaphoreId semaphore)
+{
+    CGPUTimelineSemaphore_Vulkan* Semaphore = (CGPUTimelineSemaphore_Vulkan*)semaphore;
+    if (Semaphore->pEmulated)
+        return VkUtil_EmulatedTimelineQuery(Semaphore->pEmulated);
+    uint64_t value = 0;
+#if VK_KHR_timeline_semaphore
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)semaphore->device;
+    PFN_vkGetSemaphoreCounterValueKHR pfnGetSemaphoreCounterValue = D->mVkDeviceTable.vkGetSemaphoreCounterValue ?
+        D->mVkDeviceTable.vkGetSemaphoreCounterValue : D->mVkDeviceTable.vkGetSemaphoreCounterValueKHR;
+    CHECK_VKRESULT(&D->super.adapter->instance->logger, pfnGetSemaphoreCounterValue(D->pVkDevice, Semaphore->pVkSemaphore, &value));
+#endif
+    return value;
+}
+
 uint32_t get_set_count(uint32_t set_index_mask)
 {
     // Set slots are indexed by their set number (RS->pSetLayouts[set_index]), so the
@@ -263,6 +386,25 @@ uint32_t get_set_count(uint32_t set_index_mask)
     return set_count;
 }
 
+// A set holding only one unbounded array at binding 0 is served by the device bindless heap
+static uint32_t VkUtil_BindlessClassOfTable(const CGPUDevice_Vulkan* D, const CGPURootSignature* RS, const CGPUParameterTable* param_table)
+{
+    if (!D->pBindlessHeap || !param_table || param_table->resources_count != 1) return UINT32_MAX;
+    const CGPUShaderResource* resource = &param_table->p_resources[0];
+    if (resource->binding != 0 || resource->count != 0) return UINT32_MAX;
+    for (uint32_t i = 0; i < RS->static_sampler_count; i++)
+    {
+        if (RS->p_static_samplers[i].set == param_table->set_index) return UINT32_MAX;
+    }
+    uint32_t bindless_class = UINT32_MAX;
+    if (resource->type == CGPU_RESOURCE_TYPE_TEXTURE)
+        bindless_class = CGPU_VK_BINDLESS_TEXTURES;
+    else if (resource->type == CGPU_RESOURCE_TYPE_BUFFER || resource->type == CGPU_RESOURCE_TYPE_RW_BUFFER)
+        bindless_class = CGPU_VK_BINDLESS_BUFFERS;
+    if (bindless_class == UINT32_MAX || D->pBindlessHeap->mTables[bindless_class].mCapacity == 0) return UINT32_MAX;
+    return bindless_class;
+}
+
 CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const struct CGPURootSignatureDescriptor* desc)
 {
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
@@ -282,6 +424,9 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
             RS->pSetLayouts = poolSig->pSetLayouts;
             RS->mSetLayoutCount = poolSig->mSetLayoutCount;
             RS->pPushConstRanges = poolSig->pPushConstRanges;
+            RS->empty_set_mask = poolSig->empty_set_mask;
+            RS->bindless_set_mask = poolSig->bindless_set_mask;
+            RS->use_descriptor_buffer = poolSig->use_descriptor_buffer;
             RS->super.pool = desc->pool;
             RS->super.pool_sig = &poolSig->super;
             return &RS->super;
@@ -300,6 +445,15 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
     {
         set_index_mask |= (1 << RS->super.p_static_samplers[i].set);
     }
+    // Dynamic buffers and immutable samplers have no descriptor buffer equivalent here,
+    // and bindless sets are descriptor sets, so such signatures stay on the set path
+    bool use_descriptor_buffer = D->pDescriptorBuffer && !desc->dynamic_buffers && RS->super.static_sampler_count == 0;
+    for (uint32_t i = 0; use_descriptor_buffer && i < RS->super.table_count; i++)
+    {
+        if (VkUtil_BindlessClassOfTable(D, &RS->super, &RS->super.p_tables[i]) != UINT32_MAX)
+            use_descriptor_buffer = false;
+    }
+    RS->use_descriptor_buffer = use_descriptor_buffer;
     // parse
     const uint32_t set_count = get_set_count(set_index_mask);
     RS->pSetLayouts = cgpu_calloc(allocator, set_count, sizeof(SetLayout_Vulkan));
@@ -311,7 +465,7 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
         {
             // Numbering gap: the shader never references this set slot. Use the shared
             // empty set layout; it is auto-bound at bind time (see empty_set_mask).
-            RS->pSetLayouts[set_index].layout = D->pEmptySetLayout;
+            RS->pSetLayouts[set_index].layout = use_descriptor_buffer ? D->pEmptyDescriptorBufferSetLayout : D->pEmptySetLayout;
             RS->empty_set_mask |= (1 << set_index);
             continue;
         }
@@ -324,6 +478,16 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
                 break;
             }
         }
+        const uint32_t bindless_class = VkUtil_BindlessClassOfTable(D, &RS->super, param_table);
+        if (bindless_class != UINT32_MAX)
+        {
+            // Shared with the bindless heap, bound with the pipeline (see bindless_set_mask)
+            const VkUtil_BindlessTable* BindlessTable = &D->pBindlessHeap->mTables[bindless_class];
+            RS->pSetLayouts[set_index].layout = BindlessTable->pLayout;
+            RS->pSetLayouts[set_index].pBindlessSet = BindlessTable->pSet;
+            RS->bindless_set_mask |= (1 << set_index);
+            continue;
+        }
         uint32_t bindings_count = param_table ? param_table->resources_count + desc->static_sampler_count : 0 + desc->static_sampler_count;
         VkDescriptorSetLayoutBinding* vkbindings = cgpu_calloc(allocator,
         bindings_count, sizeof(VkDescriptorSetLayoutBinding));
@@ -358,15 +522,25 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
                 i_binding++;
             }
         }
+        // record pool usage of this layout
+        for (uint32_t i = 0; i < i_binding; i++)
+        {
+            if (vkbindings[i].descriptorType < CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE)
+                RS->pSetLayouts[set_index].mDescriptorCounts[vkbindings[i].descriptorType] += vkbindings[i].descriptorCount;
+        }
         VkDescriptorSetLayoutCreateInfo setLayoutInfo = {
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = NULL,
-            .flags = 0,
+            .flags = use_descriptor_buffer ? CGPU_VK_DESCRIPTOR_BUFFER_LAYOUT_FLAGS : 0,
             .bindingCount = i_binding,
             .pBindings = vkbindings,
         };
         CHECK_VKRESULT(&device->adapter->instance->logger, D->mVkDeviceTable.vkCreateDescriptorSetLayout(D->pVkDevice,
             &setLayoutInfo, &I->vkAllocator, &RS->pSetLayouts[set_index].layout));
+        if (use_descriptor_buffer)
+        {
+            VkUtil_RecordDescriptorBufferLayout((CGPUDevice_Vulkan*)D, &RS->pSetLayouts[set_index], param_table);
+        }
 
         if (bindings_count) cgpu_free(allocator, vkbindings);
     }
@@ -402,13 +576,14 @@ CGPURootSignatureId cgpu_create_root_signature_vulkan(CGPUDeviceId device,const
         .pPushConstantRanges = RS->pPushConstRanges
     };
     CHECK_VKRESULT(&device->adapter->instance->logger, D->mVkDeviceTable.vkCreatePipelineLayout(D->pVkDevice, &pipeline_info, &I->vkAllocator, &RS->pPipelineLayout));
-    // Create Update Templates
-    if (D->mVkDeviceTable.vkCreateDescriptorUpdateTemplateKHR)
+    // Create Update Templates, descriptor buffers are written directly instead
+    if (D->mVkDeviceTable.vkCreateDescriptorUpdateTemplateKHR && !use_descriptor_buffer)
     {
         for (uint32_t i_table = 0; i_table < RS->super.table_count; i_table++)
         {
             CGPUParameterTable* param_table = &RS->super.p_tables[i_table];
             SetLayout_Vulkan* set_to_record = &RS->pSetLayouts[param_table->set_index];
+            if (RS->bindless_set_mask & (1 << param_table->set_index)) continue;
             uint32_t update_entry_count = param_table->resources_count;
             VkDescriptorUpdateTemplateEntry* template_entries = cgpu_calloc(allocator,
                 param_table->resources_count, sizeof(VkDescriptorUpdateTemplateEntry));
@@ -474,12 +649,13 @@ void cgpu_free_root_signature_vulkan(CGPUDeviceId device, CGPURootSignatureId si
     for (uint32_t i_set = 0; i_set < RS->mSetLayoutCount; i_set++)
     {
         SetLayout_Vulkan* set_to_free = &RS->pSetLayouts[i_set];
-        // Numbering-gap slots share the device-wide empty set layout; skip destroying it.
+        // Numbering-gap and bindless slots share device-wide layouts; skip destroying them.
         if (set_to_free->layout != VK_NULL_HANDLE &&
-            !(RS->empty_set_mask & (1 << i_set)))
+            !((RS->empty_set_mask | RS->bindless_set_mask) & (1 << i_set)))
             D->mVkDeviceTable.vkDestroyDescriptorSetLayout(D->pVkDevice, set_to_free->layout, &I->vkAllocator);
         if (set_to_free->pUpdateTemplate != VK_NULL_HANDLE)
             D->mVkDeviceTable.vkDestroyDescriptorUpdateTemplateKHR(D->pVkDevice, set_to_free->pUpdateTemplate, &I->vkAllocator);
+        cgpu_free(allocator, set_to_free->pDescriptorBufferOffsets);
     }
     cgpu_free(allocator, RS->pVkSetLayouts);
     cgpu_free(allocator, RS->pSetLayouts);
@@ -499,27 +675,51 @@ void cgpu_free_root_signature_pool_vulkan(CGPUDeviceId device, CGPURootSignature
     CGPUUtil_FreeRootSignaturePool(allocator, pool);
 }
 
-CGPUDescriptorSetId cgpu_create_descriptor_set_vulkan(CGPUDeviceId device, const struct CGPUDescriptorSetDescriptor* desc)
+CGPU_FORCEINLINE static size_t VkUtil_DescriptorSetUpdateDataSize(const CGPURootSignature_Vulkan* RS, uint32_t set_index)
 {
-    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
-    size_t totalSize = sizeof(CGPUDescriptorSet_Vulkan);
-    CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)desc->root_signature;
     uint32_t table_index = 0;
     for (uint32_t i = 0; i < RS->super.table_count; i++)
     {
-        if (RS->super.p_tables[i].set_index == desc->set_index)
+        if (RS->super.p_tables[i].set_index == set_index)
         {
             table_index = i;
         }
     }
+    return RS->super.p_tables[table_index].resources_count * sizeof(VkDescriptorUpdateData);
+}
+
+CGPUDescriptorSetId cgpu_create_descriptor_set_vulkan(CGPUDeviceId device, const struct CGPUDescriptorSetDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    size_t totalSize = sizeof(CGPUDescriptorSet_Vulkan);
+    CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)desc->root_signature;
     SetLayout_Vulkan* SetLayout = &RS->pSetLayouts[desc->set_index];
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
-    const size_t UpdateTemplateSize = RS->super.p_tables[table_index].resources_count * sizeof(VkDescriptorUpdateData);
+    const size_t UpdateTemplateSize = VkUtil_DescriptorSetUpdateDataSize(RS, desc->set_index);
     totalSize += UpdateTemplateSize;
+    if (RS->bindless_set_mask & (1 << desc->set_index))
+    {
+        cgpu_error(&device->adapter->instance->logger, "Set %u is served by the bindless heap and is bound with the pipeline!\n", desc->set_index);
+        return CGPU_NULLPTR;
+    }
+    if (RS->use_descriptor_buffer)
+    {
+        // No pool and no template data, the set is a range of the device descriptor buffer
+        CGPUDescriptorSet_Vulkan* Set = cgpu_calloc_aligned(allocator, 1, sizeof(CGPUDescriptorSet_Vulkan), _Alignof(CGPUDescriptorSet_Vulkan));
+        if (!VkUtil_DescriptorBufferAllocate(D->pDescriptorBuffer, SetLayout->mDescriptorBufferSize,
+                &Set->mDescriptorBufferAllocation, &Set->mDescriptorBufferOffset))
+        {
+            cgpu_free_aligned(allocator, Set);
+            return CGPU_NULLPTR;
+        }
+        return &Set->super;
+    }
     CGPUDescriptorSet_Vulkan* Set = cgpu_calloc_aligned(allocator, 1, totalSize, _Alignof(CGPUDescriptorSet_Vulkan));
     char* pMem = (char*)(Set + 1);
     // Allocate Descriptor Set
-    VkUtil_ConsumeDescriptorSets(D->pDescriptorPool, &SetLayout->layout, &Set->pVkDescriptorSet, 1);
+    Set->pDescriptorPool = VkUtil_AcquireDescriptorPoolShard((CGPUDevice_Vulkan*)D);
+    Set->pVkDescriptorPool = VkUtil_ConsumeDescriptorSets(Set->pDescriptorPool,
+        &SetLayout->layout, SetLayout->mDescriptorCounts, &Set->pVkDescriptorSet, 1);
     // Fill Update Template Data
     Set->pUpdateData = (VkDescriptorUpdateData*)pMem;
     memset(Set->pUpdateData, 0, UpdateTemplateSize);
@@ -537,40 +737,29 @@ void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count,
         if (RS->super.p_tables[i].set_index == set->index)
         {
             table_index = i;
+            break;
         }
     }
     SetLayout_Vulkan* SetLayout = &RS->pSetLayouts[set->index];
     const CGPUParameterTable* ParamTable = &RS->super.p_tables[table_index];
-    if (SetLayout->pUpdateTemplate)
+    if (RS->use_descriptor_buffer)
+    {
+        VkUtil_UpdateDescriptorBufferSet(Set, ParamTable, table_index, count, datas);
+    }
+    else if (SetLayout->pUpdateTemplate)
     {
+        // The template writes every entry, so untouched bindings keep their last written data
         VkDescriptorUpdateData* pUpdateData = Set->pUpdateData;
-        memset(pUpdateData, 0, count * sizeof(VkDescriptorUpdateData));
         bool dirty = false;
         for (uint32_t i = 0; i < count; i++)
         {
             // Descriptor Info
             const CGPUDescriptorData* pParam = datas + i;
-            const CGPUShaderResource* ResData = CGPU_NULLPTR;
-            if (pParam->name != CGPU_NULLPTR)
+            const CGPUShaderResource* ResData = CGPUUtil_FindDescriptorResource(ParamTable, table_index, pParam);
+            if (ResData == CGPU_NULLPTR)
             {
-                size_t argNameHash = cgpu_name_hash(pParam->name, strlen(pParam->name));
-                for (uint32_t p = 0; p < ParamTable->resources_count; p++)
-                {
-                    if (ParamTable->p_resources[p].name_hash == argNameHash)
-                    {
-                        ResData = ParamTable->p_resources + p;
-                    }
-                }
-            }
-            else
-            {
-                for (uint32_t p = 0; p < ParamTable->resources_count; p++)
-                {
-                    if (ParamTable->p_resources[p].binding == pParam->binding)
-                    {
-                        ResData = ParamTable->p_resources + p;
-                    }
-                }
+                cgpu_assert(0 && "Descriptor binding not found in set!");
+                continue;
             }
             // Update Info
             const uint32_t arrayCount = cgpu_max(1U, pParam->count);
@@ -646,31 +835,52 @@ void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count,
     }
     else
     {
-        VkDescriptorBufferInfo m_descriptorBuffers[6];
-        VkDescriptorImageInfo m_descriptorSamplers[16];
-        VkDescriptorImageInfo m_descriptorInputSamplers[16];
-        VkWriteDescriptorSet m_descriptorWrites[38];
+        // Size the batch up front: one write per descriptor data covering its whole array
+        uint32_t infoCount = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            infoCount += cgpu_max(1U, datas[i].count);
+        }
+        CGPU_DECLARE_ZERO_VLA(VkDescriptorImageInfo, imageInfos, infoCount + 1)
+        CGPU_DECLARE_ZERO_VLA(VkDescriptorBufferInfo, bufferInfos, infoCount + 1)
+        CGPU_DECLARE_ZERO_VLA(VkWriteDescriptorSet, descriptorWrites, count + 1)
+        // dynamic_buffer_count is only non-zero if the set layout uses dynamic buffers
+        const bool dynamicBuffers = ParamTable->dynamic_buffer_count > 0;
 
+        uint32_t imageCount = 0;
         uint32_t bufferCount = 0;
-        uint32_t textureCount = 0;
         uint32_t writeCount = 0;
-
-        bool dirty = false;
         for (uint32_t i = 0; i < count; ++i)
         {
             const CGPUDescriptorData* pParam = datas + i;
+            const CGPUShaderResource* ResData = CGPUUtil_FindDescriptorResource(ParamTable, table_index, pParam);
+            if (ResData == CGPU_NULLPTR)
+            {
+                cgpu_assert(0 && "Descriptor binding not found in set!");
+                continue;
+            }
             const uint32_t arrayCount = cgpu_max(1U, pParam->count);
-            const ECGPUResourceTypeFlags resourceType = (ECGPUResourceTypeFlags)pParam->binding_type;
+            const ECGPUResourceTypeFlags resourceType = (ECGPUResourceTypeFlags)ResData->type;
+            VkWriteDescriptorSet* writeInfo = descriptorWrites + writeCount;
+            writeInfo->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeInfo->pNext = VK_NULL_HANDLE;
+            writeInfo->dstSet = Set->pVkDescriptorSet;
+            writeInfo->dstBinding = ResData->binding;
+            writeInfo->dstArrayElement = 0;
+            writeInfo->descriptorType = VkUtil_TranslateResourceTypeConvertToDynamic(resourceType, dynamicBuffers);
+            writeInfo->descriptorCount = arrayCount;
             switch (resourceType)
             {
             case CGPU_RESOURCE_TYPE_RW_TEXTURE:
             case CGPU_RESOURCE_TYPE_TEXTURE: {
                 cgpu_assert(pParam->resources.textures && "cgpu_assert: Binding NULL texture(s)");
                 CGPUTextureView_Vulkan** TextureViews = (CGPUTextureView_Vulkan**)pParam->resources.textures;
+                writeInfo->pImageInfo = imageInfos + imageCount;
                 for (uint32_t arr = 0; arr < arrayCount; ++arr)
                 {
+                    // TODO: Stencil support
                     cgpu_assert(pParam->resources.textures[arr] && "cgpu_assert: Binding NULL texture!");
-                    VkDescriptorImageInfo* imageInfo = m_descriptorSamplers + textureCount;
+                    VkDescriptorImageInfo* imageInfo = imageInfos + imageCount++;
                     imageInfo->imageLayout =
                         resourceType == CGPU_RESOURCE_TYPE_RW_TEXTURE
                         ? VK_IMAGE_LAYOUT_GENERAL
@@ -680,52 +890,23 @@ void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count,
                         ? TextureViews[arr]->pVkUAVDescriptor
                         : TextureViews[arr]->pVkSRVDescriptor;
                     imageInfo->sampler = VK_NULL_HANDLE;
-                    ++textureCount;
-
-                    VkWriteDescriptorSet* writeInfo = m_descriptorWrites + writeCount;
-                    writeInfo->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-                    writeInfo->pNext = VK_NULL_HANDLE;
-                    writeInfo->dstSet = Set->pVkDescriptorSet;
-                    writeInfo->dstBinding = pParam->binding;
-                    writeInfo->dstArrayElement = 0;
-                    writeInfo->descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-                    writeInfo->descriptorCount = 1;
-                    writeInfo->pImageInfo = imageInfo;
-                    writeInfo->pBufferInfo = VK_NULL_HANDLE;
-                    writeInfo->pTexelBufferView = VK_NULL_HANDLE;
-                    ++writeCount;
-
-                    dirty = true;
                 }
+                ++writeCount;
                 break;
             }
             case CGPU_RESOURCE_TYPE_SAMPLER: {
                 cgpu_assert(pParam->resources.samplers && "cgpu_assert: Binding NULL Sampler(s)");
                 CGPUSampler_Vulkan** Samplers = (CGPUSampler_Vulkan**)pParam->resources.samplers;
+                writeInfo->pImageInfo = imageInfos + imageCount;
                 for (uint32_t arr = 0; arr < arrayCount; ++arr)
                 {
                     cgpu_assert(pParam->resources.samplers[arr] && "cgpu_assert: Binding NULL Sampler!");
-                    VkDescriptorImageInfo* imageInfo = m_descriptorSamplers + textureCount;
+                    VkDescriptorImageInfo* imageInfo = imageInfos + imageCount++;
                     imageInfo->imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
                     imageInfo->imageView = VK_NULL_HANDLE;
                     imageInfo->sampler = Samplers[arr]->pVkSampler;
-                    ++textureCount;
-
-                    VkWriteDescriptorSet* writeInfo = m_descriptorWrites + writeCount;
-                    writeInfo->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-                    writeInfo->pNext = VK_NULL_HANDLE;
-                    writeInfo->dstSet = Set->pVkDescriptorSet;
-                    writeInfo->dstBinding = pParam->binding;
-                    writeInfo->dstArrayElement = 0;
-                    writeInfo->descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
-                    writeInfo->descriptorCount = 1;
-                    writeInfo->pImageInfo = imageInfo;
-                    writeInfo->pBufferInfo = VK_NULL_HANDLE;
-                    writeInfo->pTexelBufferView = VK_NULL_HANDLE;
-                    ++writeCount;
-
-                    dirty = true;
                 }
+                ++writeCount;
                 break;
             }
             case CGPU_RESOURCE_TYPE_UNIFORM_BUFFER:
@@ -735,10 +916,11 @@ void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count,
             case CGPU_RESOURCE_TYPE_RW_BUFFER_RAW: {
                 cgpu_assert(pParam->resources.buffers && "cgpu_assert: Binding NULL Buffer(s)!");
                 CGPUBuffer_Vulkan** Buffers = (CGPUBuffer_Vulkan**)pParam->resources.buffers;
+                writeInfo->pBufferInfo = bufferInfos + bufferCount;
                 for (uint32_t arr = 0; arr < arrayCount; ++arr)
                 {
                     cgpu_assert(pParam->resources.buffers[arr] && "cgpu_assert: Binding NULL Buffer!");
-                    VkDescriptorBufferInfo* bufferInfo = m_descriptorBuffers + bufferCount;
+                    VkDescriptorBufferInfo* bufferInfo = bufferInfos + bufferCount++;
                     bufferInfo->buffer = Buffers[arr]->pVkBuffer;
                     bufferInfo->offset = Buffers[arr]->mOffset;
                     bufferInfo->range = VK_WHOLE_SIZE;
@@ -747,34 +929,18 @@ void cgpu_update_descriptor_set_vulkan(CGPUDescriptorSetId set, uint32_t count,
                         bufferInfo->offset = pParam->params.buffers_params.offsets[arr];
                         bufferInfo->range = pParam->params.buffers_params.sizes[arr];
                     }
-                    ++bufferCount;
-
-                    VkWriteDescriptorSet* writeInfo = m_descriptorWrites + writeCount;
-                    writeInfo->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-                    writeInfo->pNext = VK_NULL_HANDLE;
-                    writeInfo->dstSet = Set->pVkDescriptorSet;
-                    writeInfo->dstBinding = pParam->binding;
-                    writeInfo->dstArrayElement = 0;
-                    writeInfo->descriptorType = resourceType == CGPU_RESOURCE_TYPE_UNIFORM_BUFFER ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-                    writeInfo->descriptorCount = 1;
-                    writeInfo->pImageInfo = VK_NULL_HANDLE;
-                    writeInfo->pBufferInfo = bufferInfo;
-                    writeInfo->pTexelBufferView = VK_NULL_HANDLE;
-                    ++writeCount;
-
-                    dirty = true;
                 }
+                ++writeCount;
                 break;
             }
             default:
                 cgpu_assert(0 && resourceType && "Descriptor Type not supported!");
                 break;
             }
-
-            if ((textureCount == 16 || bufferCount == 6 || writeCount == 38) || (i == count - 1 && writeCount > 0))
-            {
-                D->mVkDeviceTable.vkUpdateDescriptorSets(D->pVkDevice, writeCount, m_descriptorWrites, 0, VK_NULL_HANDLE);
-            }
+        }
+        if (writeCount > 0)
+        {
+            D->mVkDeviceTable.vkUpdateDescriptorSets(D->pVkDevice, writeCount, descriptorWrites, 0, VK_NULL_HANDLE);
         }
     }
 }
@@ -784,10 +950,275 @@ void cgpu_free_descriptor_set_vulkan(CGPUDeviceId device, CGPUDescriptorSetId se
     CGPUDescriptorSet_Vulkan* Set = (CGPUDescriptorSet_Vulkan*)set;
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)set->root_signature->device;
     const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
-    VkUtil_ReturnDescriptorSets(D->pDescriptorPool, &Set->pVkDescriptorSet, 1);
+    if (Set->mTransient)
+    {
+        cgpu_assert(0 && "Descriptor sets allocated from an arena are released by cgpu_descriptor_arena_reset!");
+        return;
+    }
+    const CGPURootSignature_Vulkan* RS = (const CGPURootSignature_Vulkan*)set->root_signature;
+    if (RS->use_descriptor_buffer)
+    {
+        VkUtil_DescriptorBufferFree(D->pDescriptorBuffer, Set->mDescriptorBufferAllocation);
+        cgpu_free_aligned(allocator, Set);
+        return;
+    }
+    VkUtil_ReturnDescriptorSets(Set->pDescriptorPool, Set->pVkDescriptorPool,
+        RS->pSetLayouts[set->index].mDescriptorCounts, &Set->pVkDescriptorSet, 1);
     cgpu_free_aligned(allocator, Set);
 }
 
+// Descriptor Arena
+typedef struct VkUtil_ArenaHostBlock {
+    struct VkUtil_ArenaHostBlock* pNext;
+    size_t mSize;
+    size_t mUsed;
+} VkUtil_ArenaHostBlock;
+
+#define CGPU_VK_ARENA_HOST_BLOCK_SIZE (64 * 1024)
+#define CGPU_VK_ARENA_HOST_ALIGNMENT 16
+#define CGPU_VK_ARENA_HOST_BLOCK_HEADER cgpu_round_up(sizeof(VkUtil_ArenaHostBlock), CGPU_VK_ARENA_HOST_ALIGNMENT)
+
+static void* VkUtil_ArenaHostAllocate(CGPUDescriptorArena_Vulkan* Arena, const CGPUAllocator* allocator, size_t size)
+{
+    size = cgpu_round_up(size, CGPU_VK_ARENA_HOST_ALIGNMENT);
+    VkUtil_ArenaHostBlock* Prev = CGPU_NULLPTR;
+    VkUtil_ArenaHostBlock* Block = Arena->pCurrentHostBlock;
+    while (Block && Block->mUsed + size > Block->mSize)
+    {
+        Prev = Block;
+        Block = Block->pNext;
+    }
+    if (!Block)
+    {
+        const size_t blockSize = cgpu_max((size_t)CGPU_VK_ARENA_HOST_BLOCK_SIZE, size);
+        Block = (VkUtil_ArenaHostBlock*)cgpu_malloc_aligned(allocator,
+            CGPU_VK_ARENA_HOST_BLOCK_HEADER + blockSize, CGPU_VK_ARENA_HOST_ALIGNMENT);
+        Block->pNext = CGPU_NULLPTR;
+        Block->mSize = blockSize;
+        Block->mUsed = 0;
+        if (Prev) Prev->pNext = Block;
+        else if (!Arena->pHostBlocks) Arena->pHostBlocks = Block;
+        else
+        {
+            VkUtil_ArenaHostBlock* Tail = Arena->pHostBlocks;
+            while (Tail->pNext) Tail = Tail->pNext;
+            Tail->pNext = Block;
+        }
+    }
+    Arena->pCurrentHostBlock = Block;
+    void* ptr = (char*)Block + CGPU_VK_ARENA_HOST_BLOCK_HEADER + Block->mUsed;
+    Block->mUsed += size;
+    return ptr;
+}
+
+CGPUDescriptorArenaId cgpu_create_descriptor_arena_vulkan(CGPUDeviceId device, const struct CGPUDescriptorArenaDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    CGPUDescriptorArena_Vulkan* Arena = cgpu_calloc(allocator, 1, sizeof(CGPUDescriptorArena_Vulkan));
+    Arena->mMaxSetsPerPool = desc->max_sets_per_pool ? desc->max_sets_per_pool : CGPU_VK_DESCRIPTOR_POOL_MAX_SETS;
+    return &Arena->super;
+}
+
+CGPUDescriptorSetId cgpu_descriptor_arena_allocate_set_vulkan(CGPUDescriptorArenaId arena, const struct CGPUDescriptorSetDescriptor* desc)
+{
+    CGPUDescriptorArena_Vulkan* Arena = (CGPUDescriptorArena_Vulkan*)arena;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)arena->device;
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+    CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)desc->root_signature;
+    SetLayout_Vulkan* SetLayout = &RS->pSetLayouts[desc->set_index];
+    if (RS->use_descriptor_buffer)
+    {
+        // Descriptor buffer ranges are recorded and handed back all at once on reset
+        uint64_t allocation = 0;
+        VkDeviceSize offset = 0;
+        if (!VkUtil_DescriptorBufferAllocate(D->pDescriptorBuffer, SetLayout->mDescriptorBufferSize, &allocation, &offset))
+            return CGPU_NULLPTR;
+        if (Arena->mDescriptorBufferAllocationCount == Arena->mDescriptorBufferAllocationCapacity)
+        {
+            Arena->mDescriptorBufferAllocationCapacity = cgpu_max(16u, Arena->mDescriptorBufferAllocationCapacity * 2);
+            Arena->pDescriptorBufferAllocations = (uint64_t*)cgpu_realloc(allocator,
+                Arena->pDescriptorBufferAllocations, Arena->mDescriptorBufferAllocationCapacity * sizeof(uint64_t));
+        }
+        Arena->pDescriptorBufferAllocations[Arena->mDescriptorBufferAllocationCount++] = allocation;
+        CGPUDescriptorSet_Vulkan* Set = VkUtil_ArenaHostAllocate(Arena, allocator, sizeof(CGPUDescriptorSet_Vulkan));
+        memset(Set, 0, sizeof(CGPUDescriptorSet_Vulkan));
+        Set->mDescriptorBufferAllocation = allocation;
+        Set->mDescriptorBufferOffset = offset;
+        Set->mTransient = true;
+        return &Set->super;
+    }
+    // Bump allocate from the current pool, move on to the next (or a new) pool once it is exhausted
+    VkDescriptorSetAllocateInfo alloc_info = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .pNext = NULL,
+        .descriptorPool = VK_NULL_HANDLE,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &SetLayout->layout
+    };
+    VkDescriptorSet pVkDescriptorSet = VK_NULL_HANDLE;
+    for (;;)
+    {
+        const bool newPool = Arena->mCurrentPool == Arena->mPoolCount;
+        if (newPool)
+        {
+            if (Arena->mPoolCount == Arena->mPoolCapacity)
+            {
+                Arena->mPoolCapacity = cgpu_max(4u, Arena->mPoolCapacity * 2);
+                Arena->pVkDescPools = (VkDescriptorPool*)cgpu_realloc(allocator,
+                    Arena->pVkDescPools, Arena->mPoolCapacity * sizeof(VkDescriptorPool));
+            }
+            VkDescriptorPool pool = VkUtil_CreateTransientDescriptorPool(D, Arena->mMaxSetsPerPool, SetLayout->mDescriptorCounts);
+            if (pool == VK_NULL_HANDLE) return CGPU_NULLPTR;
+            Arena->pVkDescPools[Arena->mPoolCount++] = pool;
+        }
+        alloc_info.descriptorPool = Arena->pVkDescPools[Arena->mCurrentPool];
+        VkResult vk_res = D->mVkDeviceTable.vkAllocateDescriptorSets(D->pVkDevice, &alloc_info, &pVkDescriptorSet);
+        if (vk_res == VK_SUCCESS) break;
+        if (newPool || (vk_res != VK_ERROR_OUT_OF_POOL_MEMORY && vk_res != VK_ERROR_FRAGMENTED_POOL))
+        {
+            cgpu_assert(0 && "Failed to allocate descriptor set from descriptor arena!");
+            return CGPU_NULLPTR;
+        }
+        Arena->mCurrentPool++;
+    }
+    const size_t UpdateTemplateSize = VkUtil_DescriptorSetUpdateDataSize(RS, desc->set_index);
+    CGPUDescriptorSet_Vulkan* Set = VkUtil_ArenaHostAllocate(Arena, allocator, sizeof(CGPUDescriptorSet_Vulkan) + UpdateTemplateSize);
+    memset(Set, 0, sizeof(CGPUDescriptorSet_Vulkan) + UpdateTemplateSize);
+    Set->pVkDescriptorSet = pVkDescriptorSet;
+    Set->pVkDescriptorPool = alloc_info.descriptorPool;
+    Set->pUpdateData = (VkDescriptorUpdateData*)(Set + 1);
+    Set->mTransient = true;
+    return &Set->super;
+}
+
+void cgpu_reset_descriptor_arena_vulkan(CGPUDescriptorArenaId arena)
+{
+    CGPUDescriptorArena_Vulkan* Arena = (CGPUDescriptorArena_Vulkan*)arena;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)arena->device;
+    // Pools after the current one haven't been touched since the last reset
+    const uint32_t usedPools = cgpu_min(Arena->mCurrentPool + 1, Arena->mPoolCount);
+    for (uint32_t i = 0; i < usedPools; i++)
+    {
+        D->mVkDeviceTable.vkResetDescriptorPool(D->pVkDevice, Arena->pVkDescPools[i], 0);
+    }
+    Arena->mCurrentPool = 0;
+    for (uint32_t i = 0; i < Arena->mDescriptorBufferAllocationCount; i++)
+    {
+        VkUtil_DescriptorBufferFree(D->pDescriptorBuffer, Arena->pDescriptorBufferAllocations[i]);
+    }
+    Arena->mDescriptorBufferAllocationCount = 0;
+    for (VkUtil_ArenaHostBlock* Block = Arena->pHostBlocks; Block; Block = Block->pNext)
+    {
+        Block->mUsed = 0;
+    }
+    Arena->pCurrentHostBlock = Arena->pHostBlocks;
+}
+
+void cgpu_free_descriptor_arena_vulkan(CGPUDeviceId device, CGPUDescriptorArenaId arena)
+{
+    CGPUDescriptorArena_Vulkan* Arena = (CGPUDescriptorArena_Vulkan*)arena;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)arena->device;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)D->super.adapter->instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    for (uint32_t i = 0; i < Arena->mPoolCount; i++)
+    {
+        D->mVkDeviceTable.vkDestroyDescriptorPool(D->pVkDevice, Arena->pVkDescPools[i], &I->vkAllocator);
+    }
+    VkUtil_ArenaHostBlock* Block = Arena->pHostBlocks;
+    while (Block)
+    {
+        VkUtil_ArenaHostBlock* Next = Block->pNext;
+        cgpu_free_aligned(allocator, Block);
+        Block = Next;
+    }
+    for (uint32_t i = 0; i < Arena->mDescriptorBufferAllocationCount; i++)
+    {
+        VkUtil_DescriptorBufferFree(D->pDescriptorBuffer, Arena->pDescriptorBufferAllocations[i]);
+    }
+    cgpu_free(allocator, Arena->pDescriptorBufferAllocations);
+    cgpu_free(allocator, Arena->pVkDescPools);
+    cgpu_free(allocator, Arena);
+}
+
+// Bindless Heap APIs
+static uint32_t VkUtil_WriteBindlessDescriptor(CGPUDevice_Vulkan* D, uint32_t bindless_class,
+    const VkDescriptorImageInfo* image_info, const VkDescriptorBufferInfo* buffer_info)
+{
+    VkUtil_BindlessHeap* Heap = D->pBindlessHeap;
+    if (Heap == CGPU_NULLPTR || Heap->mTables[bindless_class].mCapacity == 0)
+    {
+        cgpu_warn(&D->super.adapter->instance->logger, "Bindless registration without a bindless heap of that class!\n");
+        return CGPU_INVALID_BINDLESS_INDEX;
+    }
+    const uint32_t index = VkUtil_BindlessAllocateIndex(Heap, bindless_class);
+    if (index == CGPU_INVALID_BINDLESS_INDEX)
+    {
+        cgpu_warn(&D->super.adapter->instance->logger, "Bindless heap is full!\n");
+        return CGPU_INVALID_BINDLESS_INDEX;
+    }
+    // Update-after-bind lets this run while the set is bound by in-flight command buffers
+    const VkUtil_BindlessTable* Table = &Heap->mTables[bindless_class];
+    VkWriteDescriptorSet write = {
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .pNext = NULL,
+        .dstSet = Table->pSet,
+        .dstBinding = 0,
+        .dstArrayElement = index,
+        .descriptorCount = 1,
+        .descriptorType = Table->mType,
+        .pImageInfo = image_info,
+        .pBufferInfo = buffer_info
+    };
+    D->mVkDeviceTable.vkUpdateDescriptorSets(D->pVkDevice, 1, &write, 0, NULL);
+    return index;
+}
+
+uint32_t cgpu_register_bindless_texture_view_vulkan(CGPUDeviceId device, CGPUTextureViewId view)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    const CGPUTextureView_Vulkan* View = (const CGPUTextureView_Vulkan*)view;
+    cgpu_assert(View->pVkSRVDescriptor != VK_NULL_HANDLE && "Bindless texture view must be created with SRV usage!");
+    VkDescriptorImageInfo image_info = {
+        .sampler = VK_NULL_HANDLE,
+        .imageView = View->pVkSRVDescriptor,
+        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    };
+    return VkUtil_WriteBindlessDescriptor(D, CGPU_VK_BINDLESS_TEXTURES, &image_info, NULL);
+}
+
+uint32_t cgpu_register_bindless_buffer_vulkan(CGPUDeviceId device, CGPUBufferId buffer)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    VkDescriptorBufferInfo buffer_info = {
+        .buffer = Buffer->pVkBuffer,
+        .offset = Buffer->mOffset,
+        .range = VK_WHOLE_SIZE
+    };
+    return VkUtil_WriteBindlessDescriptor(D, CGPU_VK_BINDLESS_BUFFERS, NULL, &buffer_info);
+}
+
+void cgpu_unregister_bindless_texture_view_vulkan(CGPUDeviceId device, uint32_t index)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    if (D->pBindlessHeap == CGPU_NULLPTR || index == CGPU_INVALID_BINDLESS_INDEX) return;
+    VkUtil_BindlessReleaseIndex(D->pBindlessHeap, CGPU_VK_BINDLESS_TEXTURES, index);
+}
+
+void cgpu_unregister_bindless_buffer_vulkan(CGPUDeviceId device, uint32_t index)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    if (D->pBindlessHeap == CGPU_NULLPTR || index == CGPU_INVALID_BINDLESS_INDEX) return;
+    VkUtil_BindlessReleaseIndex(D->pBindlessHeap, CGPU_VK_BINDLESS_BUFFERS, index);
+}
+
+void cgpu_advance_bindless_frame_vulkan(CGPUDeviceId device, CGPUFenceId fence)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    if (D->pBindlessHeap == CGPU_NULLPTR) return;
+    VkUtil_AdvanceBindlessFrame(D->pBindlessHeap, fence);
+}
+
 CGPUComputePipelineId cgpu_create_compute_pipeline_vulkan(CGPUDeviceId device, const struct CGPUComputePipelineDescriptor* desc)
 {
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
@@ -809,7 +1240,7 @@ CGPUComputePipelineId cgpu_create_compute_pipeline_vulkan(CGPUDeviceId device, c
     VkComputePipelineCreateInfo pipeline_info = {
         .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
         .pNext = NULL,
-        .flags = 0,
+        .flags = RS->use_descriptor_buffer ? CGPU_VK_DESCRIPTOR_BUFFER_PIPELINE_FLAGS : 0,
         .stage = cs_stage_info,
         .layout = RS->pPipelineLayout,
         .basePipelineHandle = 0,
@@ -1101,6 +1532,7 @@ CGPURenderPipelineId cgpu_create_render_pipeline_vulkan(CGPUDeviceId device, con
     CGPURenderPass_Vulkan* R = (CGPURenderPass_Vulkan*)desc->render_pass;
     VkGraphicsPipelineCreateInfo pipelineInfo = {
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .flags = RS->use_descriptor_buffer ? CGPU_VK_DESCRIPTOR_BUFFER_PIPELINE_FLAGS : 0,
         .stageCount = stage_count,
         .pStages = shaderStages,
         .pVertexInputState = &vi,
@@ -1188,22 +1620,60 @@ void cgpu_free_query_pool_vulkan(CGPUDeviceId device, CGPUQueryPoolId pool)
 
 CGPUMemoryPoolId cgpu_create_memory_pool_vulkan(CGPUDeviceId device, const struct CGPUMemoryPoolDescriptor* desc)
 {
-    VmaPool vmaPool;
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    // Pools are bound to one memory type, so it is chosen up front from the usage alone
+    VmaAllocationCreateInfo mem_reqs = {
+        .usage = (VmaMemoryUsage)desc->memory_usage
+    };
+    uint32_t memoryTypeIndex = 0;
+    VkResult res = vmaFindMemoryTypeIndex(D->pVmaAllocator, UINT32_MAX, &mem_reqs, &memoryTypeIndex);
+    if (res != VK_SUCCESS)
+    {
+        cgpu_error(&device->adapter->instance->logger, u8"CGPU VULKAN: No memory type matches the memory pool usage! Error code: %d\n", res);
+        return CGPU_NULLPTR;
+    }
     VmaPoolCreateInfo poolInfo = {
-        .memoryTypeIndex = 0,
-        .flags = 0,
+        .memoryTypeIndex = memoryTypeIndex,
+        .flags = (desc->type == CGPU_MEMORY_POOL_TYPE_LINEAR) ? VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT : 0,
         .blockSize = desc->block_size,
         .minBlockCount = desc->min_block_count,
         .maxBlockCount = desc->max_block_count,
         .minAllocationAlignment = desc->min_alloc_alignment,
     };
-    vmaCreatePool(D->pVmaAllocator, &poolInfo, &vmaPool);
-    return NULL;
+    VmaPool vmaPool = VK_NULL_HANDLE;
+    res = vmaCreatePool(D->pVmaAllocator, &poolInfo, &vmaPool);
+    if (res != VK_SUCCESS)
+    {
+        cgpu_error(&device->adapter->instance->logger, u8"CGPU VULKAN: Failed to create memory pool! Error code: %d\n", res);
+        return CGPU_NULLPTR;
+    }
+    CGPUMemoryPool_Vulkan* P = (CGPUMemoryPool_Vulkan*)cgpu_calloc(allocator, 1, sizeof(CGPUMemoryPool_Vulkan));
+    P->pVmaPool = vmaPool;
+    P->mMemoryTypeIndex = memoryTypeIndex;
+    return &P->super;
 }
 
 void cgpu_free_memory_pool_vulkan(CGPUDeviceId device, CGPUMemoryPoolId pool)
 {
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    CGPUMemoryPool_Vulkan* P = (CGPUMemoryPool_Vulkan*)pool;
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    // Every buffer and texture allocated from the pool must be freed first
+    vmaDestroyPool(D->pVmaAllocator, P->pVmaPool);
+    cgpu_free(allocator, P);
+}
+
+void cgpu_query_memory_pool_statistics_vulkan(CGPUMemoryPoolId pool, CGPUMemoryPoolStatistics* stats)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pool->device;
+    CGPUMemoryPool_Vulkan* P = (CGPUMemoryPool_Vulkan*)pool;
+    CGPU_DECLARE_ZERO(VmaStatistics, vmaStats)
+    vmaGetPoolStatistics(D->pVmaAllocator, P->pVmaPool, &vmaStats);
+    stats->block_count = vmaStats.blockCount;
+    stats->allocation_count = vmaStats.allocationCount;
+    stats->block_bytes = vmaStats.blockBytes;
+    stats->allocation_bytes = vmaStats.allocationBytes;
 }
 
 // Queue APIs
@@ -1243,84 +1713,340 @@ CGPUQueueId cgpu_get_queue_vulkan(CGPUDeviceId device, ECGPUQueueType type, uint
     return &RQ->super;
 }
 
-ECGPUSubmitError cgpu_submit_queue_vulkan(CGPUQueueId queue, const struct CGPUQueueSubmitDescriptor* desc)
+void VkUtil_QueueInitialBufferState(CGPUQueue_Vulkan* Q, CGPUBuffer_Vulkan* B, ECGPUResourceStateFlags state)
 {
-    uint32_t CmdCount = desc->cmd_count;
-    CGPUCommandBuffer_Vulkan** Cmds = (CGPUCommandBuffer_Vulkan**)desc->p_cmds;
-    CGPUQueue_Vulkan* Q = (CGPUQueue_Vulkan*)queue;
-    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)queue->device;
-    CGPUFence_Vulkan* F = (CGPUFence_Vulkan*)desc->signal_fence;
-
-    // cgpu_assert that given cmd list and given params are valid
-    cgpu_assert(CmdCount > 0);
-    cgpu_assert(Cmds);
-    // execute given command list
-    cgpu_assert(Q->pVkQueue != VK_NULL_HANDLE);
-
-    CGPU_DECLARE_ZERO_VLA(VkCommandBuffer, vkCmds, CmdCount);
-    for (uint32_t i = 0; i < CmdCount; ++i)
-    {
-        vkCmds[i] = Cmds[i]->pVkCmdBuf;
-    }
-    // Set wait semaphores
-    CGPU_DECLARE_ZERO_VLA(VkSemaphore, wait_semaphores, desc->wait_semaphore_count + 1)
-    CGPU_DECLARE_ZERO_VLA(VkPipelineStageFlags, wait_stages, desc->wait_semaphore_count + 1)
-    uint32_t waitCount = 0;
-    CGPUSemaphore_Vulkan** WaitSemaphores = (CGPUSemaphore_Vulkan**)desc->p_wait_semaphores;
-    for (uint32_t i = 0; i < desc->wait_semaphore_count; ++i)
-    {
-        if (WaitSemaphores[i]->mSignaled)
-        {
-            wait_semaphores[waitCount] = WaitSemaphores[i]->pVkSemaphore;
-            wait_stages[waitCount] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
-            WaitSemaphores[i]->mSignaled = false;
-            ++waitCount;
-        }
-    }
-    // Set signal semaphores
-    CGPU_DECLARE_ZERO_VLA(VkSemaphore, signal_semaphores, desc->signal_semaphore_count + 1)
-    uint32_t signalCount = 0;
-    CGPUSemaphore_Vulkan** SignalSemaphores = (CGPUSemaphore_Vulkan**)desc->p_signal_semaphores;
-    for (uint32_t i = 0; i < desc->signal_semaphore_count; ++i)
+    const CGPUAllocator* allocator = &Q->super.device->adapter->instance->allocator;
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
+#endif
+    if (Q->mPendingBufferInitCount == Q->mPendingBufferInitCapacity)
     {
-        if (!SignalSemaphores[i]->mSignaled)
-        {
-            signal_semaphores[signalCount] = SignalSemaphores[i]->pVkSemaphore;
-            SignalSemaphores[i]->mSignaled = true;
-            ++signalCount;
-        }
+        Q->mPendingBufferInitCapacity = cgpu_max(16u, Q->mPendingBufferInitCapacity * 2);
+        Q->pPendingBufferInits = (CGPUBufferBarrier*)cgpu_realloc(allocator, Q->pPendingBufferInits, Q->mPendingBufferInitCapacity * sizeof(CGPUBufferBarrier));
     }
-    // Submit
-    VkSubmitInfo submit_info = {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .pNext = NULL,
-        .waitSemaphoreCount = waitCount,
-        .pWaitSemaphores = waitCount > 0 ? wait_semaphores : VK_NULL_HANDLE,
-        .pWaitDstStageMask = waitCount > 0 ? wait_stages : VK_NULL_HANDLE,
-        .commandBufferCount = CmdCount,
-        .pCommandBuffers = vkCmds,
-        .signalSemaphoreCount = signalCount,
-        .pSignalSemaphores = signalCount > 0 ? signal_semaphores : VK_NULL_HANDLE,
+    Q->pPendingBufferInits[Q->mPendingBufferInitCount++] = (CGPUBufferBarrier){
+        .buffer = &B->super,
+        .src_state = CGPU_RESOURCE_STATE_UNDEFINED,
+        .dst_state = state
     };
+    B->pInitQueue = Q;
+    B->mInitPending = true;
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_release(Q->pMutex);
+#endif
+}
+
+void VkUtil_QueueInitialTextureState(CGPUQueue_Vulkan* Q, CGPUTexture_Vulkan* T, ECGPUResourceStateFlags state)
+{
+    const CGPUAllocator* allocator = &Q->super.device->adapter->instance->allocator;
 #ifdef CGPU_THREAD_SAFETY
     if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
 #endif
-    VkResult res = D->mVkDeviceTable.vkQueueSubmit(Q->pVkQueue, 1, &submit_info, F ? F->pVkFence : VK_NULL_HANDLE);
-    ECGPUSubmitError error;
-    if (res == VK_SUCCESS)
-        error = CGPU_SUBMIT_ERROR_SUCCESS;
-    else
+    if (Q->mPendingTextureInitCount == Q->mPendingTextureInitCapacity)
+    {
+        Q->mPendingTextureInitCapacity = cgpu_max(16u, Q->mPendingTextureInitCapacity * 2);
+        Q->pPendingTextureInits = (CGPUTextureBarrier*)cgpu_realloc(allocator, Q->pPendingTextureInits, Q->mPendingTextureInitCapacity * sizeof(CGPUTextureBarrier));
+    }
+    Q->pPendingTextureInits[Q->mPendingTextureInitCount++] = (CGPUTextureBarrier){
+        .texture = &T->super,
+        .src_state = CGPU_RESOURCE_STATE_UNDEFINED,
+        .dst_state = state
+    };
+    T->pInitQueue = Q;
+    T->mInitPending = true;
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_release(Q->pMutex);
+#endif
+}
+
+// Resources freed before their owner queue submitted anything must not reach the barrier,
+// the pending flag is checked under the lock as a concurrent flush may be clearing it
+void VkUtil_CancelInitialState(CGPUQueue_Vulkan* Q, const void* resource, bool* pInitPending)
+{
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
+#endif
+    for (uint32_t i = 0; *pInitPending && i < Q->mPendingBufferInitCount; i++)
+    {
+        if ((const void*)Q->pPendingBufferInits[i].buffer != resource) continue;
+        Q->pPendingBufferInits[i] = Q->pPendingBufferInits[--Q->mPendingBufferInitCount];
+        *pInitPending = false;
+    }
+    for (uint32_t i = 0; *pInitPending && i < Q->mPendingTextureInitCount; i++)
+    {
+        if ((const void*)Q->pPendingTextureInits[i].texture != resource) continue;
+        Q->pPendingTextureInits[i] = Q->pPendingTextureInits[--Q->mPendingTextureInitCount];
+        *pInitPending = false;
+    }
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_release(Q->pMutex);
+#endif
+}
+
+// Records every pending initial transition into one internal command buffer and submits it ahead of
+// the caller's work, submission order makes the barriers visible to everything submitted later.
+// Must be called with the queue lock held.
+static void VkUtil_FlushInitialStates(CGPUQueue_Vulkan* Q)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Q->super.device;
+    if (Q->mPendingBufferInitCount + Q->mPendingTextureInitCount == 0) return;
+    // The previous batch went out at an earlier submit, so this rarely blocks
+    cgpu_wait_fences(1, &Q->pInnerFence);
+    cgpu_command_pool_reset(Q->pInnerCmdPool);
+    cgpu_command_buffer_begin(Q->pInnerCmdBuffer);
+    CGPUResourceBarrierDescriptor init_barrier_d = {
+        .buffer_barrier_count = Q->mPendingBufferInitCount,
+        .p_buffer_barriers = Q->pPendingBufferInits,
+        .texture_barrier_count = Q->mPendingTextureInitCount,
+        .p_texture_barriers = Q->pPendingTextureInits,
+    };
+    cgpu_command_buffer_resource_barrier(Q->pInnerCmdBuffer, &init_barrier_d);
+    cgpu_command_buffer_end(Q->pInnerCmdBuffer);
+    for (uint32_t i = 0; i < Q->mPendingBufferInitCount; i++)
+        ((CGPUBuffer_Vulkan*)Q->pPendingBufferInits[i].buffer)->mInitPending = false;
+    for (uint32_t i = 0; i < Q->mPendingTextureInitCount; i++)
+        ((CGPUTexture_Vulkan*)Q->pPendingTextureInits[i].texture)->mInitPending = false;
+    Q->mPendingBufferInitCount = 0;
+    Q->mPendingTextureInitCount = 0;
+
+    CGPUFence_Vulkan* F = (CGPUFence_Vulkan*)Q->pInnerFence;
+    const VkCommandBuffer pVkCmdBuf = ((CGPUCommandBuffer_Vulkan*)Q->pInnerCmdBuffer)->pVkCmdBuf;
+    VkSubmitInfo submit_info = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = NULL,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &pVkCmdBuf,
+    };
+    CHECK_VKRESULT(&D->super.adapter->instance->logger, D->mVkDeviceTable.vkQueueSubmit(Q->pVkQueue, 1, &submit_info, F->pVkFence));
+    F->mSubmitted = true;
+}
+
+// A resource first used on a queue other than its owner cannot rely on the owner's next submit,
+// so the transition is submitted on the owner queue now and waited for before recording goes on
+static void VkUtil_ResolveCrossQueueInitialState(CGPUQueue_Vulkan* Q, const bool* pInitPending)
+{
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
+#endif
+    if (*pInitPending)
+    {
+        VkUtil_FlushInitialStates(Q);
+        cgpu_wait_fences(1, &Q->pInnerFence);
+    }
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_release(Q->pMutex);
+#endif
+}
+
+ECGPUSubmitError cgpu_submit_queue_vulkan(CGPUQueueId queue, const struct CGPUQueueSubmitDescriptor* desc)
+{
+    // cgpu_assert that given cmd list and given params are valid
+    cgpu_assert(desc->cmd_count > 0);
+    cgpu_assert(desc->p_cmds);
+    return cgpu_submit_queue_batches_vulkan(queue, 1, desc);
+}
+
+// Submits a run of batches, then the fences that emulated timeline signals of those batches complete
+static ECGPUSubmitError VkUtil_SubmitBatchRange(CGPUQueue_Vulkan* Q, const CGPUQueueSubmitDescriptor* descs,
+    const VkSubmitInfo* submit_infos, uint32_t batch_count, VkFence fence)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Q->super.device;
+    VkResult res = D->mVkDeviceTable.vkQueueSubmit(Q->pVkQueue, batch_count, submit_infos, fence);
+    if (res != VK_SUCCESS)
     {
         cgpu_error(&D->super.adapter->instance->logger, u8"CGPU VULKAN: Failed to submit queue! Error code: %d\n", res);
         if (res == VK_ERROR_DEVICE_LOST)
         {
             D->super.is_lost = true;
-            error = CGPU_SUBMIT_ERROR_DEVICE_LOST;
+            return CGPU_SUBMIT_ERROR_DEVICE_LOST;
         }
-        else
-            error = CGPU_SUBMIT_ERROR_OTHER_FATAL;
+        return CGPU_SUBMIT_ERROR_OTHER_FATAL;
+    }
+    // Emulated timeline signals are fences submitted behind the batches, so they can land later than their batch
+    for (uint32_t b = 0; b < batch_count; ++b)
+    {
+        const CGPUQueueSubmitDescriptor* desc = &descs[b];
+        for (uint32_t i = 0; i < desc->signal_timeline_count; ++i)
+        {
+            CGPUTimelineSemaphore_Vulkan* Timeline = (CGPUTimelineSemaphore_Vulkan*)desc->p_signal_timelines[i];
+            if (!Timeline->pEmulated) continue;
+            VkFence pointFence = VkUtil_EmulatedTimelineAddPoint(Timeline->pEmulated, desc->p_signal_timeline_values[i]);
+            if (pointFence != VK_NULL_HANDLE)
+                CHECK_VKRESULT(&D->super.adapter->instance->logger, D->mVkDeviceTable.vkQueueSubmit(Q->pVkQueue, 0, CGPU_NULLPTR, pointFence));
+        }
+    }
+    return CGPU_SUBMIT_ERROR_SUCCESS;
+}
+
+ECGPUSubmitError cgpu_submit_queue_batches_vulkan(CGPUQueueId queue, uint32_t batch_count, const struct CGPUQueueSubmitDescriptor* descs)
+{
+    CGPUQueue_Vulkan* Q = (CGPUQueue_Vulkan*)queue;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)queue->device;
+    CGPUFence_Vulkan* F = CGPU_NULLPTR;
+    // execute given command list
+    cgpu_assert(Q->pVkQueue != VK_NULL_HANDLE);
+    if (batch_count == 0) return CGPU_SUBMIT_ERROR_SUCCESS;
+
+    // Batches share VkQueueSubmits, so their handles are packed into shared arrays
+    uint32_t totalCmdCount = 0, totalWaitCount = 0, totalSignalCount = 0;
+    for (uint32_t b = 0; b < batch_count; ++b)
+    {
+        const CGPUQueueSubmitDescriptor* desc = &descs[b];
+        totalCmdCount += desc->cmd_count;
+        totalWaitCount += desc->wait_semaphore_count + desc->wait_timeline_count;
+        totalSignalCount += desc->signal_semaphore_count + desc->signal_timeline_count;
+        if (descs[b].signal_fence)
+        {
+            // A VkFence signals once every batch of the submit has completed
+            cgpu_assert((!F || F == (CGPUFence_Vulkan*)descs[b].signal_fence) && "fatal: batches of one submit can signal only one fence!");
+            F = (CGPUFence_Vulkan*)descs[b].signal_fence;
+        }
+    }
+    CGPU_DECLARE_ZERO_VLA(VkSubmitInfo, submit_infos, batch_count)
+    CGPU_DECLARE_ZERO_VLA(VkCommandBuffer, vkCmds, totalCmdCount + 1)
+    CGPU_DECLARE_ZERO_VLA(VkSemaphore, wait_semaphores, totalWaitCount + 1)
+    CGPU_DECLARE_ZERO_VLA(VkPipelineStageFlags, wait_stages, totalWaitCount + 1)
+    CGPU_DECLARE_ZERO_VLA(VkSemaphore, signal_semaphores, totalSignalCount + 1)
+#if VK_KHR_timeline_semaphore
+    // Binary semaphores in a batch with timelines take a value that is ignored
+    CGPU_DECLARE_ZERO_VLA(VkTimelineSemaphoreSubmitInfoKHR, timeline_infos, batch_count)
+    CGPU_DECLARE_ZERO_VLA(uint64_t, wait_values, totalWaitCount + 1)
+    CGPU_DECLARE_ZERO_VLA(uint64_t, signal_values, totalSignalCount + 1)
+#endif
+    // Used for waits without an explicit stage, matches what every wait used to block
+    const VkPipelineStageFlags defaultWaitStages = VkUtil_TranslatePipelineStages((CGPUAdapter_Vulkan*)D->super.adapter,
+        CGPU_PIPELINE_STAGE_RENDER_TARGET | CGPU_PIPELINE_STAGE_COMPUTE | CGPU_PIPELINE_STAGE_COPY, queue->type);
+    uint32_t cmdOffset = 0, waitOffset = 0, signalOffset = 0;
+    for (uint32_t b = 0; b < batch_count; ++b)
+    {
+        const CGPUQueueSubmitDescriptor* desc = &descs[b];
+        CGPUCommandBuffer_Vulkan** Cmds = (CGPUCommandBuffer_Vulkan**)desc->p_cmds;
+        for (uint32_t i = 0; i < desc->cmd_count; ++i)
+        {
+            vkCmds[cmdOffset + i] = Cmds[i]->pVkCmdBuf;
+        }
+        // Set wait semaphores, batches are processed in order so a batch can wait on an earlier one
+        uint32_t waitCount = 0;
+        CGPUSemaphore_Vulkan** WaitSemaphores = (CGPUSemaphore_Vulkan**)desc->p_wait_semaphores;
+        for (uint32_t i = 0; i < desc->wait_semaphore_count; ++i)
+        {
+            if (WaitSemaphores[i]->mSignaled)
+            {
+                wait_semaphores[waitOffset + waitCount] = WaitSemaphores[i]->pVkSemaphore;
+                const ECGPUPipelineStageFlags stages = desc->p_wait_stages ? desc->p_wait_stages[i] : 0;
+                wait_stages[waitOffset + waitCount] = stages ?
+                    VkUtil_TranslatePipelineStages((CGPUAdapter_Vulkan*)D->super.adapter, stages, queue->type) : defaultWaitStages;
+                WaitSemaphores[i]->mSignaled = false;
+                ++waitCount;
+            }
+        }
+#if VK_KHR_timeline_semaphore
+        bool hasTimelines = false;
+        for (uint32_t i = 0; i < desc->wait_timeline_count; ++i)
+        {
+            CGPUTimelineSemaphore_Vulkan* Timeline = (CGPUTimelineSemaphore_Vulkan*)desc->p_wait_timelines[i];
+            if (Timeline->pEmulated) continue;
+            wait_semaphores[waitOffset + waitCount] = Timeline->pVkSemaphore;
+            const ECGPUPipelineStageFlags stages = desc->p_wait_timeline_stages ? desc->p_wait_timeline_stages[i] : 0;
+            wait_stages[waitOffset + waitCount] = stages ?
+                VkUtil_TranslatePipelineStages((CGPUAdapter_Vulkan*)D->super.adapter, stages, queue->type) : defaultWaitStages;
+            wait_values[waitOffset + waitCount] = desc->p_wait_timeline_values[i];
+            hasTimelines = true;
+            ++waitCount;
+        }
+#endif
+        // Set signal semaphores
+        uint32_t signalCount = 0;
+        CGPUSemaphore_Vulkan** SignalSemaphores = (CGPUSemaphore_Vulkan**)desc->p_signal_semaphores;
+        for (uint32_t i = 0; i < desc->signal_semaphore_count; ++i)
+        {
+            if (!SignalSemaphores[i]->mSignaled)
+            {
+                signal_semaphores[signalOffset + signalCount] = SignalSemaphores[i]->pVkSemaphore;
+                SignalSemaphores[i]->mSignaled = true;
+                ++signalCount;
+            }
+        }
+        const void* pNext = NULL;
+#if VK_KHR_timeline_semaphore
+        for (uint32_t i = 0; i < desc->signal_timeline_count; ++i)
+        {
+            CGPUTimelineSemaphore_Vulkan* Timeline = (CGPUTimelineSemaphore_Vulkan*)desc->p_signal_timelines[i];
+            if (Timeline->pEmulated) continue;
+            signal_semaphores[signalOffset + signalCount] = Timeline->pVkSemaphore;
+            signal_values[signalOffset + signalCount] = desc->p_signal_timeline_values[i];
+            hasTimelines = true;
+            ++signalCount;
+        }
+        if (hasTimelines)
+        {
+            timeline_infos[b] = (VkTimelineSemaphoreSubmitInfoKHR){
+                .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+                .pNext = NULL,
+                .waitSemaphoreValueCount = waitCount,
+                .pWaitSemaphoreValues = waitCount > 0 ? wait_values + waitOffset : NULL,
+                .signalSemaphoreValueCount = signalCount,
+                .pSignalSemaphoreValues = signalCount > 0 ? signal_values + signalOffset : NULL,
+            };
+            pNext = &timeline_infos[b];
+        }
+#endif
+        submit_infos[b] = (VkSubmitInfo){
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = pNext,
+            .waitSemaphoreCount = waitCount,
+            .pWaitSemaphores = waitCount > 0 ? wait_semaphores + waitOffset : VK_NULL_HANDLE,
+            .pWaitDstStageMask = waitCount > 0 ? wait_stages + waitOffset : VK_NULL_HANDLE,
+            .commandBufferCount = desc->cmd_count,
+            .pCommandBuffers = desc->cmd_count > 0 ? vkCmds + cmdOffset : VK_NULL_HANDLE,
+            .signalSemaphoreCount = signalCount,
+            .pSignalSemaphores = signalCount > 0 ? signal_semaphores + signalOffset : VK_NULL_HANDLE,
+        };
+        cmdOffset += desc->cmd_count;
+        waitOffset += waitCount;
+        signalOffset += signalCount;
+    }
+    // Submit
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
+#endif
+    VkUtil_FlushInitialStates(Q);
+    // Emulated timeline waits resolve on the host, so the submit is split in front of every batch that has one:
+    // the batches before it are submitted first, then the wait blocks until a submitted signal reaches its value
+    ECGPUSubmitError error = CGPU_SUBMIT_ERROR_SUCCESS;
+    uint32_t segmentStart = 0;
+    for (uint32_t b = 0; error == CGPU_SUBMIT_ERROR_SUCCESS && b < batch_count; ++b)
+    {
+        const CGPUQueueSubmitDescriptor* desc = &descs[b];
+        bool hasEmulatedWaits = false;
+        for (uint32_t i = 0; i < desc->wait_timeline_count; ++i)
+        {
+            if (desc->p_wait_timelines[i]->emulated) hasEmulatedWaits = true;
+        }
+        if (!hasEmulatedWaits) continue;
+        if (b > segmentStart)
+            error = VkUtil_SubmitBatchRange(Q, descs + segmentStart, submit_infos + segmentStart, b - segmentStart, VK_NULL_HANDLE);
+        segmentStart = b;
+        for (uint32_t i = 0; error == CGPU_SUBMIT_ERROR_SUCCESS && i < desc->wait_timeline_count; ++i)
+        {
+            CGPUTimelineSemaphore_Vulkan* Timeline = (CGPUTimelineSemaphore_Vulkan*)desc->p_wait_timelines[i];
+            if (Timeline->pEmulated && !VkUtil_EmulatedTimelineWait(Timeline->pEmulated, desc->p_wait_timeline_values[i], UINT64_MAX))
+            {
+                // Nothing signals the value yet, submitting anyway would run the batch ahead of its producer
+                cgpu_error(&D->super.adapter->instance->logger,
+                    u8"CGPU VULKAN: Emulated timeline wait on value %llu that no submitted signal reaches!\n",
+                    (unsigned long long)desc->p_wait_timeline_values[i]);
+                error = CGPU_SUBMIT_ERROR_OTHER_FATAL;
+            }
+        }
+    }
+    // The fence goes with the last submission, so it still signals after every batch
+    if (error == CGPU_SUBMIT_ERROR_SUCCESS)
+    {
+        error = VkUtil_SubmitBatchRange(Q, descs + segmentStart, submit_infos + segmentStart,
+            batch_count - segmentStart, F ? F->pVkFence : VK_NULL_HANDLE);
+        if (F) F->mSubmitted = true;
     }
-    if (F) F->mSubmitted = true;
 #ifdef CGPU_THREAD_SAFETY
     if (Q->pMutex) skr_mutex_release(Q->pMutex);
 #endif
@@ -1331,6 +2057,13 @@ void cgpu_wait_queue_idle_vulkan(CGPUQueueId queue)
 {
     CGPUQueue_Vulkan* Q = (CGPUQueue_Vulkan*)queue;
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)queue->device;
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
+#endif
+    VkUtil_FlushInitialStates(Q);
+#ifdef CGPU_THREAD_SAFETY
+    if (Q->pMutex) skr_mutex_release(Q->pMutex);
+#endif
     D->mVkDeviceTable.vkQueueWaitIdle(Q->pVkQueue);
 }
 
@@ -1403,6 +2136,11 @@ void cgpu_free_queue_vulkan(CGPUDeviceId device, CGPUQueueId queue)
 {
     const CGPUAllocator* allocator = &queue->device->adapter->instance->allocator;
     CGPUQueue_Vulkan* Q = (CGPUQueue_Vulkan*)queue;
+    // Pending initial transitions still have to reach the GPU before the inner command buffer goes away
+    VkUtil_FlushInitialStates(Q);
+    if (Q->pInnerFence) cgpu_wait_fences(1, &Q->pInnerFence);
+    if (Q->pPendingBufferInits) cgpu_free(allocator, Q->pPendingBufferInits);
+    if (Q->pPendingTextureInits) cgpu_free(allocator, Q->pPendingTextureInits);
     if (Q->pInnerCmdBuffer) cgpu_command_pool_free_command_buffer(Q->pInnerCmdPool, Q->pInnerCmdBuffer);
     if (Q->pInnerCmdPool) cgpu_queue_free_command_pool(queue, Q->pInnerCmdPool);
     if (Q->pInnerFence) cgpu_device_free_fence(device, Q->pInnerFence);
@@ -1636,6 +2374,7 @@ CGPUCommandBufferId cgpu_create_command_buffer_vulkan(CGPUCommandPoolId pool, co
     cgpu_assert(Cmd);
 
     Cmd->mType = Q->super.type;
+    Cmd->mSecondary = desc->is_secondary;
 
     VkCommandBufferAllocateInfo alloc_info = {
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
@@ -1663,6 +2402,7 @@ void cgpu_free_command_buffer_vulkan(CGPUCommandPoolId pool, CGPUCommandBufferId
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Q->super.device;
     const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
     D->mVkDeviceTable.vkFreeCommandBuffers(D->pVkDevice, P->pVkCmdPool, 1, &(Cmd->pVkCmdBuf));
+    VkUtil_FreePendingBarriers(Cmd);
     cgpu_free_aligned(allocator, Cmd);
 }
 
@@ -1675,11 +2415,81 @@ void cgpu_free_command_pool_vulkan(CGPUQueueId queue, CGPUCommandPoolId pool)
     cgpu_free(allocator, P);
 }
 
+// Bound state shadow
+static void VkUtil_ResetBoundState(CGPUCommandBuffer_Vulkan* Cmd)
+{
+    Cmd->pBoundPipelineLayout = VK_NULL_HANDLE;
+    Cmd->mDescriptorBufferBound = false;
+    Cmd->pPushConstantLayout = VK_NULL_HANDLE;
+    Cmd->mPushConstantValidMask = 0;
+    memset(Cmd->mBindPoints, 0, sizeof(Cmd->mBindPoints));
+    memset(Cmd->pVertexBuffers, 0, sizeof(Cmd->pVertexBuffers));
+    memset(Cmd->mVertexBufferOffsets, 0, sizeof(Cmd->mVertexBufferOffsets));
+    Cmd->pIndexBuffer = VK_NULL_HANDLE;
+    Cmd->mIndexBufferOffset = 0;
+    Cmd->mIndexType = VK_INDEX_TYPE_UINT32;
+    Cmd->mViewportValid = false;
+    Cmd->mScissorValid = false;
+}
+
+static BindPointState_Vulkan* VkUtil_GetBindPointState(CGPUCommandBuffer_Vulkan* Cmd, VkPipelineBindPoint bindPoint)
+{
+    return &Cmd->mBindPoints[bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE ? 1 : 0];
+}
+
+static void VkUtil_InvalidateBoundSets(CGPUCommandBuffer_Vulkan* Cmd, VkPipelineBindPoint bindPoint)
+{
+    BindPointState_Vulkan* BP = VkUtil_GetBindPointState(Cmd, bindPoint);
+    BP->pSetLayout = VK_NULL_HANDLE;
+    memset(BP->pSets, 0, sizeof(BP->pSets));
+}
+
+static void VkUtil_CmdBindPipeline(CGPUCommandBuffer_Vulkan* Cmd, VkPipelineBindPoint bindPoint, VkPipeline pipeline)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
+    BindPointState_Vulkan* BP = VkUtil_GetBindPointState(Cmd, bindPoint);
+    if (BP->pPipeline == pipeline)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
+    }
+    D->mVkDeviceTable.vkCmdBindPipeline(Cmd->pVkCmdBuf, bindPoint, pipeline);
+    BP->pPipeline = pipeline;
+    Cmd->mEmittedStateCalls++;
+}
+
+// Sets bound with dynamic offsets are never elided and not recorded
+static void VkUtil_CmdBindDescriptorSet(CGPUCommandBuffer_Vulkan* Cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+    uint32_t index, VkDescriptorSet set, uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
+    BindPointState_Vulkan* BP = VkUtil_GetBindPointState(Cmd, bindPoint);
+    if (BP->pSetLayout != layout)
+    {
+        BP->pSetLayout = layout;
+        memset(BP->pSets, 0, sizeof(BP->pSets));
+    }
+    const bool shadowed = index < CGPU_VK_SHADOWED_SET_COUNT;
+    if (shadowed && dynamic_offset_count == 0 && BP->pSets[index] == set)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
+    }
+    D->mVkDeviceTable.vkCmdBindDescriptorSets(Cmd->pVkCmdBuf,
+    bindPoint, layout, index, 1, &set,
+    dynamic_offset_count, p_dynamic_offsets);
+    if (shadowed) BP->pSets[index] = dynamic_offset_count ? VK_NULL_HANDLE : set;
+    Cmd->mEmittedStateCalls++;
+}
+
 // CMDs
 void cgpu_cmd_begin_vulkan(CGPUCommandBufferId cmd)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
+    // Secondary levels require inheritance info, which only cgpu_cmd_begin_secondary_vulkan provides
+    cgpu_assert(!Cmd->mSecondary && "fatal: secondary command buffers must begin with cgpu_cmd_begin_secondary!");
+    if (Cmd->mSecondary) return;
     VkCommandBufferBeginInfo begin_info = {
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = NULL,
@@ -1687,86 +2497,373 @@ void cgpu_cmd_begin_vulkan(CGPUCommandBufferId cmd)
         .pInheritanceInfo = NULL
     };
     CHECK_VKRESULT(&cmd->device->adapter->instance->logger, D->mVkDeviceTable.vkBeginCommandBuffer(Cmd->pVkCmdBuf, &begin_info));
-    Cmd->pBoundPipelineLayout = VK_NULL_HANDLE;
+    VkUtil_ResetBoundState(Cmd);
+    Cmd->mPendingBarriers.mBufferCount = 0;
+    Cmd->mPendingBarriers.mImageCount = 0;
+    Cmd->mElidedStateCalls = 0;
+    Cmd->mEmittedStateCalls = 0;
+    Cmd->mRequestedBarriers = 0;
+    Cmd->mEmittedBarriers = 0;
+    Cmd->mEmittedBarrierCalls = 0;
 }
 
-void cgpu_cmd_resource_barrier_vulkan(CGPUCommandBufferId cmd, const struct CGPUResourceBarrierDescriptor* desc)
+CGPURenderPassEncoderId cgpu_cmd_begin_secondary_vulkan(CGPUCommandBufferId cmd, const struct CGPUCommandBufferInheritanceInfo* inheritance)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
+    if (!Cmd->mSecondary)
+    {
+        cgpu_error(&D->super.adapter->instance->logger, "Only secondary command buffers can begin with inheritance info!\n");
+        return CGPU_NULLPTR;
+    }
+    const CGPURenderPass_Vulkan* R = (const CGPURenderPass_Vulkan*)inheritance->render_pass;
+    const CGPUFramebuffer_Vulkan* F = (const CGPUFramebuffer_Vulkan*)inheritance->framebuffer;
+    VkCommandBufferInheritanceInfo inheritance_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        .pNext = NULL,
+        .renderPass = R ? R->pVkRenderPass : VK_NULL_HANDLE,
+        .subpass = inheritance->subpass,
+        // Optional, but lets the driver specialize the secondary for the framebuffer
+        .framebuffer = F ? F->pVkFramebuffer : VK_NULL_HANDLE,
+        .occlusionQueryEnable = VK_FALSE,
+        .queryFlags = 0,
+        .pipelineStatistics = 0
+    };
+    VkCommandBufferBeginInfo begin_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = NULL,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | (R ? VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT : 0),
+        .pInheritanceInfo = &inheritance_info
+    };
+    CHECK_VKRESULT(&cmd->device->adapter->instance->logger, D->mVkDeviceTable.vkBeginCommandBuffer(Cmd->pVkCmdBuf, &begin_info));
+    VkUtil_ResetBoundState(Cmd);
+    Cmd->mPendingBarriers.mBufferCount = 0;
+    Cmd->mPendingBarriers.mImageCount = 0;
+    Cmd->mElidedStateCalls = 0;
+    Cmd->mEmittedStateCalls = 0;
+    Cmd->mRequestedBarriers = 0;
+    Cmd->mEmittedBarriers = 0;
+    Cmd->mEmittedBarrierCalls = 0;
+    Cmd->pRenderPass = inheritance_info.renderPass;
+    return R ? (CGPURenderPassEncoderId)cmd : CGPU_NULLPTR;
+}
+
+void cgpu_cmd_execute_secondaries_vulkan(CGPUCommandBufferId cmd, uint32_t count, const CGPUCommandBufferId* secondaries)
+{
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
+    if (count == 0) return;
+    CGPU_DECLARE_ZERO_VLA(VkCommandBuffer, vkCmdBufs, count)
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const CGPUCommandBuffer_Vulkan* Secondary = (const CGPUCommandBuffer_Vulkan*)secondaries[i];
+        cgpu_assert(Secondary->mSecondary && "fatal: only secondary command buffers can be executed!");
+        vkCmdBufs[i] = Secondary->pVkCmdBuf;
+    }
+    D->mVkDeviceTable.vkCmdExecuteCommands(Cmd->pVkCmdBuf, count, vkCmdBufs);
+    // Bound state is undefined after vkCmdExecuteCommands
+    VkUtil_ResetBoundState(Cmd);
+}
+
+#if VK_KHR_synchronization2
+// Sync1 barrier structs and their stages, re-emitted through vkCmdPipelineBarrier2
+static void VkUtil_CmdPipelineBarrier2(CGPUCommandBuffer_Vulkan* Cmd,
+    uint32_t bufferBarrierCount, const VkBufferMemoryBarrier* pBufferBarriers, const VkPipelineStageFlags* pBufferSrcStages, const VkPipelineStageFlags* pBufferDstStages,
+    uint32_t imageBarrierCount, const VkImageMemoryBarrier* pImageBarriers, const VkPipelineStageFlags* pImageSrcStages, const VkPipelineStageFlags* pImageDstStages)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
+    CGPU_DECLARE_ZERO_VLA(VkBufferMemoryBarrier2KHR, BB2s, cgpu_max(bufferBarrierCount, 1))
+    CGPU_DECLARE_ZERO_VLA(VkImageMemoryBarrier2KHR, TB2s, cgpu_max(imageBarrierCount, 1))
+    for (uint32_t i = 0; i < bufferBarrierCount; i++)
+    {
+        const VkBufferMemoryBarrier* BB = &pBufferBarriers[i];
+        BB2s[i] = (VkBufferMemoryBarrier2KHR){
+            .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR,
+            .pNext = NULL,
+            .srcStageMask = pBufferSrcStages[i],
+            .srcAccessMask = BB->srcAccessMask,
+            .dstStageMask = pBufferDstStages[i],
+            .dstAccessMask = BB->dstAccessMask,
+            .srcQueueFamilyIndex = BB->srcQueueFamilyIndex,
+            .dstQueueFamilyIndex = BB->dstQueueFamilyIndex,
+            .buffer = BB->buffer,
+            .offset = BB->offset,
+            .size = BB->size
+        };
+    }
+    for (uint32_t i = 0; i < imageBarrierCount; i++)
+    {
+        const VkImageMemoryBarrier* TB = &pImageBarriers[i];
+        TB2s[i] = (VkImageMemoryBarrier2KHR){
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR,
+            .pNext = NULL,
+            .srcStageMask = pImageSrcStages[i],
+            .srcAccessMask = TB->srcAccessMask,
+            .dstStageMask = pImageDstStages[i],
+            .dstAccessMask = TB->dstAccessMask,
+            .oldLayout = TB->oldLayout,
+            .newLayout = TB->newLayout,
+            .srcQueueFamilyIndex = TB->srcQueueFamilyIndex,
+            .dstQueueFamilyIndex = TB->dstQueueFamilyIndex,
+            .image = TB->image,
+            .subresourceRange = TB->subresourceRange
+        };
+    }
+    VkDependencyInfoKHR dependency_info = {
+        .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR,
+        .pNext = NULL,
+        .dependencyFlags = 0,
+        .bufferMemoryBarrierCount = bufferBarrierCount,
+        .pBufferMemoryBarriers = BB2s,
+        .imageMemoryBarrierCount = imageBarrierCount,
+        .pImageMemoryBarriers = TB2s
+    };
+    PFN_vkCmdPipelineBarrier2KHR pfnCmdPipelineBarrier2 = D->mVkDeviceTable.vkCmdPipelineBarrier2 ?
+        D->mVkDeviceTable.vkCmdPipelineBarrier2 : D->mVkDeviceTable.vkCmdPipelineBarrier2KHR;
+    pfnCmdPipelineBarrier2(Cmd->pVkCmdBuf, &dependency_info);
+}
+#endif
+
+// Whole-resource counts (VK_WHOLE_SIZE, VK_REMAINING_*) extend to the end of the resource
+static bool VkUtil_RangesOverlap(uint64_t aBase, uint64_t aCount, uint64_t bBase, uint64_t bCount, uint64_t remaining)
+{
+    const uint64_t aEnd = aCount == remaining ? UINT64_MAX : aBase + aCount;
+    const uint64_t bEnd = bCount == remaining ? UINT64_MAX : bBase + bCount;
+    return aBase < bEnd && bBase < aEnd;
+}
+
+static void VkUtil_ReservePendingBarriers(CGPUCommandBuffer_Vulkan* Cmd, bool image)
+{
+    const CGPUAllocator* allocator = &Cmd->super.device->adapter->instance->allocator;
+    PendingBarriers_Vulkan* P = &Cmd->mPendingBarriers;
+    if (!image && P->mBufferCount == P->mBufferCapacity)
+    {
+        P->mBufferCapacity = cgpu_max(16u, P->mBufferCapacity * 2);
+        P->pBufferBarriers = (VkBufferMemoryBarrier*)cgpu_realloc(allocator, P->pBufferBarriers, P->mBufferCapacity * sizeof(VkBufferMemoryBarrier));
+        P->pBufferSrcStages = (VkPipelineStageFlags*)cgpu_realloc(allocator, P->pBufferSrcStages, P->mBufferCapacity * sizeof(VkPipelineStageFlags));
+        P->pBufferDstStages = (VkPipelineStageFlags*)cgpu_realloc(allocator, P->pBufferDstStages, P->mBufferCapacity * sizeof(VkPipelineStageFlags));
+        P->pBufferDstStates = (ECGPUResourceStateFlags*)cgpu_realloc(allocator, P->pBufferDstStates, P->mBufferCapacity * sizeof(ECGPUResourceStateFlags));
+    }
+    if (image && P->mImageCount == P->mImageCapacity)
+    {
+        P->mImageCapacity = cgpu_max(16u, P->mImageCapacity * 2);
+        P->pImageBarriers = (VkImageMemoryBarrier*)cgpu_realloc(allocator, P->pImageBarriers, P->mImageCapacity * sizeof(VkImageMemoryBarrier));
+        P->pImageSrcStages = (VkPipelineStageFlags*)cgpu_realloc(allocator, P->pImageSrcStages, P->mImageCapacity * sizeof(VkPipelineStageFlags));
+        P->pImageDstStages = (VkPipelineStageFlags*)cgpu_realloc(allocator, P->pImageDstStages, P->mImageCapacity * sizeof(VkPipelineStageFlags));
+        P->pImageDstStates = (ECGPUResourceStateFlags*)cgpu_realloc(allocator, P->pImageDstStates, P->mImageCapacity * sizeof(ECGPUResourceStateFlags));
+    }
+}
+
+void VkUtil_FreePendingBarriers(CGPUCommandBuffer_Vulkan* Cmd)
+{
+    const CGPUAllocator* allocator = &Cmd->super.device->adapter->instance->allocator;
+    PendingBarriers_Vulkan* P = &Cmd->mPendingBarriers;
+    cgpu_free(allocator, P->pBufferBarriers);
+    cgpu_free(allocator, P->pBufferSrcStages);
+    cgpu_free(allocator, P->pBufferDstStages);
+    cgpu_free(allocator, P->pBufferDstStates);
+    cgpu_free(allocator, P->pImageBarriers);
+    cgpu_free(allocator, P->pImageSrcStages);
+    cgpu_free(allocator, P->pImageDstStages);
+    cgpu_free(allocator, P->pImageDstStates);
+    memset(P, 0, sizeof(PendingBarriers_Vulkan));
+}
+
+void VkUtil_FlushBarriers(CGPUCommandBuffer_Vulkan* Cmd)
+{
+    PendingBarriers_Vulkan* P = &Cmd->mPendingBarriers;
+    if (P->mBufferCount == 0 && P->mImageCount == 0) return;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+#if VK_KHR_synchronization2
+    // Each barrier keeps its own stages instead of serializing on the union of all of them
+    if (A->synchronization2)
+    {
+        VkUtil_CmdPipelineBarrier2(Cmd, P->mBufferCount, P->pBufferBarriers, P->pBufferSrcStages, P->pBufferDstStages,
+            P->mImageCount, P->pImageBarriers, P->pImageSrcStages, P->pImageDstStages);
+    }
+    else
+#endif
+    {
+        VkPipelineStageFlags srcStageMask = 0;
+        VkPipelineStageFlags dstStageMask = 0;
+        for (uint32_t i = 0; i < P->mBufferCount; i++)
+        {
+            srcStageMask |= P->pBufferSrcStages[i];
+            dstStageMask |= P->pBufferDstStages[i];
+        }
+        for (uint32_t i = 0; i < P->mImageCount; i++)
+        {
+            srcStageMask |= P->pImageSrcStages[i];
+            dstStageMask |= P->pImageDstStages[i];
+        }
+        if (srcStageMask == 0)
+            srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        if (dstStageMask == 0)
+            dstStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        D->mVkDeviceTable.vkCmdPipelineBarrier(Cmd->pVkCmdBuf,
+            srcStageMask, dstStageMask, 0,
+            0, NULL,
+            P->mBufferCount, P->pBufferBarriers,
+            P->mImageCount, P->pImageBarriers);
+    }
+    Cmd->mEmittedBarriers += P->mBufferCount + P->mImageCount;
+    Cmd->mEmittedBarrierCalls++;
+    P->mBufferCount = 0;
+    P->mImageCount = 0;
+}
+
+// A transition continuing a queued one on the same range is merged into it, any other overlap flushes first
+// because transitions of one range inside a single barrier call are unordered
+static void VkUtil_QueueBufferBarrier(CGPUCommandBuffer_Vulkan* Cmd, const VkBufferMemoryBarrier* pBarrier,
+    VkPipelineStageFlags srcStages, VkPipelineStageFlags dstStages, ECGPUResourceStateFlags srcState, ECGPUResourceStateFlags dstState)
+{
+    PendingBarriers_Vulkan* P = &Cmd->mPendingBarriers;
+    const bool ownershipTransfer = pBarrier->srcQueueFamilyIndex != pBarrier->dstQueueFamilyIndex;
+    for (uint32_t i = 0; i < P->mBufferCount; i++)
+    {
+        VkBufferMemoryBarrier* Pending = &P->pBufferBarriers[i];
+        if (Pending->buffer != pBarrier->buffer ||
+            !VkUtil_RangesOverlap(Pending->offset, Pending->size, pBarrier->offset, pBarrier->size, VK_WHOLE_SIZE))
+            continue;
+        if (!ownershipTransfer && Pending->srcQueueFamilyIndex == Pending->dstQueueFamilyIndex &&
+            Pending->offset == pBarrier->offset && Pending->size == pBarrier->size && P->pBufferDstStates[i] == srcState)
+        {
+            Pending->dstAccessMask = pBarrier->dstAccessMask;
+            P->pBufferDstStages[i] = dstStages;
+            P->pBufferDstStates[i] = dstState;
+            return;
+        }
+        VkUtil_FlushBarriers(Cmd);
+        break;
+    }
+    VkUtil_ReservePendingBarriers(Cmd, false);
+    P->pBufferBarriers[P->mBufferCount] = *pBarrier;
+    P->pBufferSrcStages[P->mBufferCount] = srcStages;
+    P->pBufferDstStages[P->mBufferCount] = dstStages;
+    P->pBufferDstStates[P->mBufferCount] = dstState;
+    P->mBufferCount++;
+}
+
+static void VkUtil_QueueImageBarrier(CGPUCommandBuffer_Vulkan* Cmd, const VkImageMemoryBarrier* pBarrier,
+    VkPipelineStageFlags srcStages, VkPipelineStageFlags dstStages, ECGPUResourceStateFlags srcState, ECGPUResourceStateFlags dstState)
+{
+    PendingBarriers_Vulkan* P = &Cmd->mPendingBarriers;
+    const bool ownershipTransfer = pBarrier->srcQueueFamilyIndex != pBarrier->dstQueueFamilyIndex;
+    const VkImageSubresourceRange* Range = &pBarrier->subresourceRange;
+    for (uint32_t i = 0; i < P->mImageCount; i++)
+    {
+        VkImageMemoryBarrier* Pending = &P->pImageBarriers[i];
+        const VkImageSubresourceRange* PendingRange = &Pending->subresourceRange;
+        if (Pending->image != pBarrier->image ||
+            !VkUtil_RangesOverlap(PendingRange->baseMipLevel, PendingRange->levelCount, Range->baseMipLevel, Range->levelCount, VK_REMAINING_MIP_LEVELS) ||
+            !VkUtil_RangesOverlap(PendingRange->baseArrayLayer, PendingRange->layerCount, Range->baseArrayLayer, Range->layerCount, VK_REMAINING_ARRAY_LAYERS))
+            continue;
+        if (!ownershipTransfer && Pending->srcQueueFamilyIndex == Pending->dstQueueFamilyIndex &&
+            memcmp(PendingRange, Range, sizeof(VkImageSubresourceRange)) == 0 && P->pImageDstStates[i] == srcState)
+        {
+            Pending->dstAccessMask = pBarrier->dstAccessMask;
+            Pending->newLayout = pBarrier->newLayout;
+            P->pImageDstStages[i] = dstStages;
+            P->pImageDstStates[i] = dstState;
+            return;
+        }
+        VkUtil_FlushBarriers(Cmd);
+        break;
+    }
+    VkUtil_ReservePendingBarriers(Cmd, true);
+    P->pImageBarriers[P->mImageCount] = *pBarrier;
+    P->pImageSrcStages[P->mImageCount] = srcStages;
+    P->pImageDstStages[P->mImageCount] = dstStages;
+    P->pImageDstStates[P->mImageCount] = dstState;
+    P->mImageCount++;
+}
+
+// Barriers are only queued here, see VkUtil_FlushBarriers
+void cgpu_cmd_resource_barrier_vulkan(CGPUCommandBufferId cmd, const struct CGPUResourceBarrierDescriptor* desc)
+{
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
     CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)cmd->device->adapter;
-    VkAccessFlags srcAccessFlags = 0;
-    VkAccessFlags dstAccessFlags = 0;
+    const ECGPUQueueType queueType = (ECGPUQueueType)Cmd->mType;
+    CGPUQueue_Vulkan* CmdQueue = (CGPUQueue_Vulkan*)cmd->pool->queue;
+    Cmd->mRequestedBarriers += desc->buffer_barrier_count + desc->texture_barrier_count;
 
-    CGPU_DECLARE_ZERO_VLA(VkBufferMemoryBarrier, BBs, cgpu_max(desc->buffer_barrier_count, 1))
-    uint32_t bufferBarrierCount = 0;
     for (uint32_t i = 0; i < desc->buffer_barrier_count; i++)
     {
         const CGPUBufferBarrier* buffer_barrier = &desc->p_buffer_barriers[i];
         CGPUBuffer_Vulkan* B = (CGPUBuffer_Vulkan*)buffer_barrier->buffer;
-        VkBufferMemoryBarrier* pBufferBarrier = NULL;
+        if (B->pInitQueue && B->pInitQueue != CmdQueue)
+            VkUtil_ResolveCrossQueueInitialState(B->pInitQueue, &B->mInitPending);
+        VkBufferMemoryBarrier BufferBarrier = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            .pNext = NULL
+        };
+        VkBufferMemoryBarrier* pBufferBarrier = &BufferBarrier;
 
         if (CGPU_RESOURCE_STATE_UNORDERED_ACCESS == buffer_barrier->src_state &&
             CGPU_RESOURCE_STATE_UNORDERED_ACCESS == buffer_barrier->dst_state)
         {
-            pBufferBarrier = &BBs[bufferBarrierCount++];                     //-V522
-            pBufferBarrier->sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER; //-V522
-            pBufferBarrier->pNext = NULL;
-
             pBufferBarrier->srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
             pBufferBarrier->dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
         }
         else
         {
-            pBufferBarrier = &BBs[bufferBarrierCount++];
-            pBufferBarrier->sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-            pBufferBarrier->pNext = NULL;
-
             pBufferBarrier->srcAccessMask = VkUtil_ResourceStateToVkAccessFlags(buffer_barrier->src_state);
             pBufferBarrier->dstAccessMask = VkUtil_ResourceStateToVkAccessFlags(buffer_barrier->dst_state);
         }
+        // Readback memory handed back in the common state is read by the host once the submit's fence signals
+        if (buffer_barrier->dst_state == CGPU_RESOURCE_STATE_COMMON && B->super.info->memory_usage == CGPU_MEMORY_USAGE_GPU_TO_CPU)
+            pBufferBarrier->dstAccessMask |= VK_ACCESS_HOST_READ_BIT;
 
-        if (pBufferBarrier)
-        {
-            pBufferBarrier->buffer = B->pVkBuffer;
-            pBufferBarrier->size = VK_WHOLE_SIZE;
-            pBufferBarrier->offset = 0;
+        cgpu_assert(buffer_barrier->offset < B->super.info->size && buffer_barrier->offset + buffer_barrier->size <= B->super.info->size &&
+                    "fatal: buffer barrier range out of bounds!");
+        pBufferBarrier->buffer = B->pVkBuffer;
+        pBufferBarrier->offset = buffer_barrier->offset;
+        pBufferBarrier->size = buffer_barrier->size ? buffer_barrier->size : VK_WHOLE_SIZE;
 
-            if (buffer_barrier->queue_acquire)
-            {
-                pBufferBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
-                pBufferBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[buffer_barrier->queue_type];
-            }
-            else if (buffer_barrier->queue_release)
-            {
-                pBufferBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
-                pBufferBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[buffer_barrier->queue_type];
-            }
-            else
-            {
-                pBufferBarrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                pBufferBarrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            }
-            srcAccessFlags |= pBufferBarrier->srcAccessMask;
-            dstAccessFlags |= pBufferBarrier->dstAccessMask;
+        if (buffer_barrier->queue_acquire)
+        {
+            pBufferBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
+            pBufferBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[buffer_barrier->queue_type];
         }
+        else if (buffer_barrier->queue_release)
+        {
+            pBufferBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
+            pBufferBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[buffer_barrier->queue_type];
+        }
+        else
+        {
+            pBufferBarrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            pBufferBarrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        }
+        // Same-state transitions are no-ops, except UAV barriers which order shader writes
+        if (buffer_barrier->src_state == buffer_barrier->dst_state &&
+            buffer_barrier->src_state != CGPU_RESOURCE_STATE_UNORDERED_ACCESS &&
+            pBufferBarrier->srcQueueFamilyIndex == pBufferBarrier->dstQueueFamilyIndex)
+            continue;
+
+        VkUtil_QueueBufferBarrier(Cmd, pBufferBarrier,
+            VkUtil_DetermineBarrierStageFlags(A, buffer_barrier->src_stage, pBufferBarrier->srcAccessMask, queueType),
+            VkUtil_DetermineBarrierStageFlags(A, buffer_barrier->dst_stage, pBufferBarrier->dstAccessMask, queueType),
+            buffer_barrier->src_state, buffer_barrier->dst_state);
     }
 
-    CGPU_DECLARE_ZERO_VLA(VkImageMemoryBarrier, TBs, cgpu_max(desc->texture_barrier_count, 1))
-    uint32_t imageBarrierCount = 0;
     for (uint32_t i = 0; i < desc->texture_barrier_count; i++)
     {
         const CGPUTextureBarrier* texture_barrier = &desc->p_texture_barriers[i];
         CGPUTexture_Vulkan* T = (CGPUTexture_Vulkan*)texture_barrier->texture;
         const CGPUTextureInfo* pInfo = T->super.info;
-        VkImageMemoryBarrier* pImageBarrier = NULL;
+        if (T->pInitQueue && T->pInitQueue != CmdQueue)
+            VkUtil_ResolveCrossQueueInitialState(T->pInitQueue, &T->mInitPending);
+        VkImageMemoryBarrier ImageBarrier = {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = NULL
+        };
+        VkImageMemoryBarrier* pImageBarrier = &ImageBarrier;
         if (CGPU_RESOURCE_STATE_UNORDERED_ACCESS == texture_barrier->src_state &&
             CGPU_RESOURCE_STATE_UNORDERED_ACCESS == texture_barrier->dst_state)
         {
-            pImageBarrier = &TBs[imageBarrierCount++];
-            pImageBarrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            pImageBarrier->pNext = NULL;
-
             pImageBarrier->srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
             pImageBarrier->dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
             pImageBarrier->oldLayout = VK_IMAGE_LAYOUT_GENERAL;
@@ -1774,64 +2871,59 @@ void cgpu_cmd_resource_barrier_vulkan(CGPUCommandBufferId cmd, const struct CGPU
         }
         else
         {
-            pImageBarrier = &TBs[imageBarrierCount++];
-            pImageBarrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            pImageBarrier->pNext = NULL;
-
             pImageBarrier->srcAccessMask = VkUtil_ResourceStateToVkAccessFlags(texture_barrier->src_state);
             pImageBarrier->dstAccessMask = VkUtil_ResourceStateToVkAccessFlags(texture_barrier->dst_state);
             pImageBarrier->oldLayout = VkUtil_ResourceStateToImageLayout(texture_barrier->src_state);
             pImageBarrier->newLayout = VkUtil_ResourceStateToImageLayout(texture_barrier->dst_state);
         }
 
-        if (pImageBarrier)
+        pImageBarrier->image = T->pVkImage;
+        pImageBarrier->subresourceRange.aspectMask = (VkImageAspectFlags)pInfo->aspect_mask;
+        if (texture_barrier->subresource_barrier)
         {
-            pImageBarrier->image = T->pVkImage;
-            pImageBarrier->subresourceRange.aspectMask = (VkImageAspectFlags)pInfo->aspect_mask;
-            pImageBarrier->subresourceRange.baseMipLevel = texture_barrier->subresource_barrier ? texture_barrier->mip_level : 0;
-            pImageBarrier->subresourceRange.levelCount = texture_barrier->subresource_barrier ? 1 : VK_REMAINING_MIP_LEVELS;
-            pImageBarrier->subresourceRange.baseArrayLayer = texture_barrier->subresource_barrier ? texture_barrier->array_layer : 0;
-            pImageBarrier->subresourceRange.layerCount = texture_barrier->subresource_barrier ? 1 : VK_REMAINING_ARRAY_LAYERS;
-
-            if (texture_barrier->queue_acquire &&
-                texture_barrier->src_state != CGPU_RESOURCE_STATE_UNDEFINED)
-            {
-                pImageBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
-                pImageBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[texture_barrier->queue_type];
-            }
-            else if (texture_barrier->queue_release &&
-                     texture_barrier->src_state != CGPU_RESOURCE_STATE_UNDEFINED)
-            {
-                pImageBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
-                pImageBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[texture_barrier->queue_type];
-            }
-            else
-            {
-                pImageBarrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                pImageBarrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            }
+            const uint32_t mipCount = cgpu_max(1u, (uint32_t)texture_barrier->mip_count);
+            const uint32_t layerCount = cgpu_max(1u, (uint32_t)texture_barrier->array_layer_count);
+            cgpu_assert(texture_barrier->mip_level + mipCount <= pInfo->mip_levels && "fatal: texture barrier mip range out of bounds!");
+            cgpu_assert(texture_barrier->array_layer + layerCount <= pInfo->array_size_minus_one + 1 && "fatal: texture barrier layer range out of bounds!");
+            pImageBarrier->subresourceRange.baseMipLevel = texture_barrier->mip_level;
+            pImageBarrier->subresourceRange.levelCount = mipCount;
+            pImageBarrier->subresourceRange.baseArrayLayer = texture_barrier->array_layer;
+            pImageBarrier->subresourceRange.layerCount = layerCount;
+        }
+        else
+        {
+            pImageBarrier->subresourceRange.baseMipLevel = 0;
+            pImageBarrier->subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+            pImageBarrier->subresourceRange.baseArrayLayer = 0;
+            pImageBarrier->subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        }
 
-            srcAccessFlags |= pImageBarrier->srcAccessMask;
-            dstAccessFlags |= pImageBarrier->dstAccessMask;
+        if (texture_barrier->queue_acquire &&
+            texture_barrier->src_state != CGPU_RESOURCE_STATE_UNDEFINED)
+        {
+            pImageBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
+            pImageBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[texture_barrier->queue_type];
         }
-    }
+        else if (texture_barrier->queue_release &&
+                 texture_barrier->src_state != CGPU_RESOURCE_STATE_UNDEFINED)
+        {
+            pImageBarrier->srcQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[Cmd->mType];
+            pImageBarrier->dstQueueFamilyIndex = (uint32_t)A->mQueueFamilyIndices[texture_barrier->queue_type];
+        }
+        else
+        {
+            pImageBarrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            pImageBarrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        }
+        if (texture_barrier->src_state == texture_barrier->dst_state &&
+            texture_barrier->src_state != CGPU_RESOURCE_STATE_UNORDERED_ACCESS &&
+            pImageBarrier->srcQueueFamilyIndex == pImageBarrier->dstQueueFamilyIndex)
+            continue;
 
-    // Commit barriers
-    VkPipelineStageFlags srcStageMask =
-    VkUtil_DeterminePipelineStageFlags(A, srcAccessFlags, (ECGPUQueueType)Cmd->mType);
-    VkPipelineStageFlags dstStageMask =
-    VkUtil_DeterminePipelineStageFlags(A, dstAccessFlags, (ECGPUQueueType)Cmd->mType);
-    if (srcStageMask == 0)
-        srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-    if (dstStageMask == 0)
-        dstStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-    if (bufferBarrierCount || imageBarrierCount)
-    {
-        D->mVkDeviceTable.vkCmdPipelineBarrier(Cmd->pVkCmdBuf,
-            srcStageMask, dstStageMask, 0,
-            0, NULL,
-            bufferBarrierCount, BBs,
-            imageBarrierCount, TBs);
+        VkUtil_QueueImageBarrier(Cmd, pImageBarrier,
+            VkUtil_DetermineBarrierStageFlags(A, texture_barrier->src_stage, pImageBarrier->srcAccessMask, queueType),
+            VkUtil_DetermineBarrierStageFlags(A, texture_barrier->dst_stage, pImageBarrier->dstAccessMask, queueType),
+            texture_barrier->src_state, texture_barrier->dst_state);
     }
 }
 
@@ -1853,6 +2945,7 @@ void cgpu_cmd_begin_query_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId pool,
 {
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUQueryPool_Vulkan* P = (CGPUQueryPool_Vulkan*)pool;
     switch (P->mType)
     {
@@ -1875,6 +2968,7 @@ void cgpu_cmd_reset_query_pool_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId p
 {
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pool->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUQueryPool_Vulkan* P = (CGPUQueryPool_Vulkan*)pool;
     D->mVkDeviceTable.vkCmdResetQueryPool(Cmd->pVkCmdBuf, P->pVkQueryPool, start_query, query_count);
 }
@@ -1888,6 +2982,7 @@ void cgpu_cmd_resolve_query_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId pool
 {
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pool->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUQueryPool_Vulkan* P = (CGPUQueryPool_Vulkan*)pool;
     CGPUBuffer_Vulkan* B = (CGPUBuffer_Vulkan*)readback;
     VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT;
@@ -1901,10 +2996,21 @@ void cgpu_cmd_resolve_query_vulkan(CGPUCommandBufferId cmd, CGPUQueryPoolId pool
 void cgpu_cmd_end_vulkan(CGPUCommandBufferId cmd)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CHECK_VKRESULT(&cmd->device->adapter->instance->logger, D->mVkDeviceTable.vkEndCommandBuffer(Cmd->pVkCmdBuf));
 }
 
+void cgpu_query_command_buffer_statistics_vulkan(CGPUCommandBufferId cmd, CGPUCommandBufferStatistics* stats)
+{
+    const CGPUCommandBuffer_Vulkan* Cmd = (const CGPUCommandBuffer_Vulkan*)cmd;
+    stats->elided_state_calls = Cmd->mElidedStateCalls;
+    stats->emitted_state_calls = Cmd->mEmittedStateCalls;
+    stats->requested_barriers = Cmd->mRequestedBarriers;
+    stats->emitted_barriers = Cmd->mEmittedBarriers;
+    stats->emitted_barrier_calls = Cmd->mEmittedBarrierCalls;
+}
+
 // Events & Markser
 void cgpu_cmd_begin_event_vulkan(CGPUCommandBufferId cmd, const CGPUEventInfo* event)
 {
@@ -1976,6 +3082,20 @@ void cgpu_cmd_end_event_vulkan(CGPUCommandBufferId cmd)
 }
 
 // Compute CMDs
+// Bindless sets never change, so they are bound once per pipeline bind
+static void VkUtil_BindBindlessSets(CGPUCommandBuffer_Vulkan* Cmd, const CGPURootSignature_Vulkan* RS, VkPipelineBindPoint bind_point)
+{
+    if (!RS->bindless_set_mask) return;
+    for (uint32_t i = 0; i < RS->mSetLayoutCount; i++)
+    {
+        if (RS->bindless_set_mask & (1 << i))
+        {
+            VkUtil_CmdBindDescriptorSet(Cmd, bind_point, RS->pPipelineLayout, i,
+            RS->pSetLayouts[i].pBindlessSet, 0, NULL);
+        }
+    }
+}
+
 CGPUComputePassEncoderId cgpu_cmd_begin_compute_pass_vulkan(CGPUCommandBufferId cmd, const struct CGPUComputePassDescriptor* desc)
 {
     // DO NOTHING NOW
@@ -1989,6 +3109,13 @@ void cgpu_compute_encoder_bind_descriptor_set_vulkan(CGPUComputePassEncoderId en
     const CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)set->root_signature;
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)set->root_signature->device;
 
+    // Descriptor buffer sets only set an offset, gap sets are never accessed and need none
+    if (RS->use_descriptor_buffer)
+    {
+        VkUtil_InvalidateBoundSets(Cmd, VK_PIPELINE_BIND_POINT_COMPUTE);
+        VkUtil_CmdBindDescriptorBufferSet(Cmd, Set, VK_PIPELINE_BIND_POINT_COMPUTE);
+        return;
+    }
     // VK requires every set slot of the pipeline layout to be bound at draw/dispatch.
     // Only numbering gaps (sets the shader never references) are auto-bound with the
     // shared empty descriptor set; referenced sets must be bound by the caller or the
@@ -2001,15 +3128,13 @@ void cgpu_compute_encoder_bind_descriptor_set_vulkan(CGPUComputePassEncoderId en
             if ((RS->empty_set_mask & (1 << i)) &&
                 Set->super.index != i)
             {
-                D->mVkDeviceTable.vkCmdBindDescriptorSets(Cmd->pVkCmdBuf,
-                VK_PIPELINE_BIND_POINT_COMPUTE, RS->pPipelineLayout, i,
-                1, &D->pEmptyDescSet, 0, NULL);
+                VkUtil_CmdBindDescriptorSet(Cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
+                RS->pPipelineLayout, i, D->pEmptyDescSet, 0, NULL);
             }
         }
     }
-    D->mVkDeviceTable.vkCmdBindDescriptorSets(Cmd->pVkCmdBuf,
-    VK_PIPELINE_BIND_POINT_COMPUTE, RS->pPipelineLayout,
-    Set->super.index, 1, &Set->pVkDescriptorSet,
+    VkUtil_CmdBindDescriptorSet(Cmd, VK_PIPELINE_BIND_POINT_COMPUTE, RS->pPipelineLayout,
+    Set->super.index, Set->pVkDescriptorSet,
     dynamic_offset_count, p_dynamic_offsets);
 }
 
@@ -2020,6 +3145,13 @@ void cgpu_render_encoder_bind_descriptor_set_vulkan(CGPURenderPassEncoderId enco
     const CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)set->root_signature;
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)set->root_signature->device;
 
+    // Descriptor buffer sets only set an offset, gap sets are never accessed and need none
+    if (RS->use_descriptor_buffer)
+    {
+        VkUtil_InvalidateBoundSets(Cmd, VK_PIPELINE_BIND_POINT_GRAPHICS);
+        VkUtil_CmdBindDescriptorBufferSet(Cmd, Set, VK_PIPELINE_BIND_POINT_GRAPHICS);
+        return;
+    }
     // VK requires every set slot of the pipeline layout to be bound at draw/dispatch.
     // Only numbering gaps (sets the shader never references) are auto-bound with the
     // shared empty descriptor set; referenced sets must be bound by the caller or the
@@ -2032,43 +3164,152 @@ void cgpu_render_encoder_bind_descriptor_set_vulkan(CGPURenderPassEncoderId enco
             if ((RS->empty_set_mask & (1 << i)) &&
                 Set->super.index != i)
             {
-                D->mVkDeviceTable.vkCmdBindDescriptorSets(Cmd->pVkCmdBuf,
-                VK_PIPELINE_BIND_POINT_GRAPHICS, RS->pPipelineLayout, i,
-                1, &D->pEmptyDescSet, 0, NULL);
+                VkUtil_CmdBindDescriptorSet(Cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                RS->pPipelineLayout, i, D->pEmptyDescSet, 0, NULL);
             }
         }
     }
-    D->mVkDeviceTable.vkCmdBindDescriptorSets(Cmd->pVkCmdBuf,
-    VK_PIPELINE_BIND_POINT_GRAPHICS, RS->pPipelineLayout,
-    Set->super.index, 1, &Set->pVkDescriptorSet,
+    VkUtil_CmdBindDescriptorSet(Cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, RS->pPipelineLayout,
+    Set->super.index, Set->pVkDescriptorSet,
     dynamic_offset_count, p_dynamic_offsets);
 }
 
+// Offset is relative to the push constant block, a zero size pushes the rest of the block
+static void VkUtil_CmdPushConstantRange(CGPUCommandBuffer_Vulkan* Cmd, const CGPURootSignature_Vulkan* RS, uint32_t slot, uint32_t offset, uint32_t size, const void* data)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)RS->super.device;
+    if (slot >= RS->super.push_constant_count)
+    {
+        cgpu_error(&D->super.adapter->instance->logger, "Push constant slot %u out of range!\n", slot);
+        return;
+    }
+    const VkPushConstantRange* range = &RS->pPushConstRanges[slot];
+    if (size == 0) size = range->size > offset ? range->size - offset : 0;
+    if (offset + size > range->size || (offset & 3) || (size & 3))
+    {
+        cgpu_error(&D->super.adapter->instance->logger, "Push constant range [%u, %u) is invalid for a block of size %u!\n", offset, offset + size, range->size);
+        return;
+    }
+    if (size == 0) return;
+    const uint32_t abs_offset = range->offset + offset;
+    if (Cmd->pPushConstantLayout != RS->pPipelineLayout)
+    {
+        Cmd->pPushConstantLayout = RS->pPipelineLayout;
+        Cmd->mPushConstantValidMask = 0;
+    }
+    // Ranges of different stages may overlap, so the bytes are split wherever the set of ranges covering
+    // them changes and every piece goes to all of those stages. The shadow then holds what each stage
+    // sees, whichever slot pushed it.
+    const uint32_t range_count = RS->super.push_constant_count;
+    CGPU_DECLARE_ZERO_VLA(uint32_t, bounds, 2 * range_count + 2)
+    uint32_t bound_count = 0;
+    bounds[bound_count++] = abs_offset;
+    bounds[bound_count++] = abs_offset + size;
+    for (uint32_t i = 0; i < range_count; i++)
+    {
+        const VkPushConstantRange* other = &RS->pPushConstRanges[i];
+        if (other->offset > abs_offset && other->offset < abs_offset + size)
+            bounds[bound_count++] = other->offset;
+        if (other->offset + other->size > abs_offset && other->offset + other->size < abs_offset + size)
+            bounds[bound_count++] = other->offset + other->size;
+    }
+    for (uint32_t i = 1; i < bound_count; i++)
+    {
+        for (uint32_t j = i; j > 0 && bounds[j - 1] > bounds[j]; j--)
+        {
+            const uint32_t t = bounds[j];
+            bounds[j] = bounds[j - 1];
+            bounds[j - 1] = t;
+        }
+    }
+    for (uint32_t b = 0; b + 1 < bound_count; b++)
+    {
+        const uint32_t piece_offset = bounds[b];
+        const uint32_t piece_size = bounds[b + 1] - piece_offset;
+        if (piece_size == 0) continue;
+        VkShaderStageFlags stages = 0;
+        for (uint32_t i = 0; i < range_count; i++)
+        {
+            const VkPushConstantRange* other = &RS->pPushConstRanges[i];
+            if (other->offset <= piece_offset && other->offset + other->size >= piece_offset + piece_size)
+                stages |= other->stageFlags;
+        }
+        const uint8_t* piece_data = (const uint8_t*)data + (piece_offset - abs_offset);
+        const bool shadowed = piece_offset + piece_size <= CGPU_VK_PUSH_CONSTANT_SHADOW_SIZE;
+        uint64_t dword_mask = 0;
+        if (shadowed)
+        {
+            const uint32_t dword_count = piece_size / 4;
+            dword_mask = (dword_count == 64 ? ~0ull : ((1ull << dword_count) - 1)) << (piece_offset / 4);
+            if ((Cmd->mPushConstantValidMask & dword_mask) == dword_mask &&
+                memcmp(Cmd->mPushConstantShadow + piece_offset, piece_data, piece_size) == 0)
+            {
+                Cmd->mElidedStateCalls++;
+                continue;
+            }
+        }
+        D->mVkDeviceTable.vkCmdPushConstants(Cmd->pVkCmdBuf, RS->pPipelineLayout,
+            stages, piece_offset, piece_size, piece_data);
+        Cmd->mEmittedStateCalls++;
+        if (shadowed)
+        {
+            memcpy(Cmd->mPushConstantShadow + piece_offset, piece_data, piece_size);
+            Cmd->mPushConstantValidMask |= dword_mask;
+        }
+    }
+}
+
+static uint32_t VkUtil_ResolvePushConstantSlot(const CGPURootSignature_Vulkan* RS, const char* name)
+{
+    const uint32_t slot = CGPUUtil_ResolvePushConstant(&RS->super, name);
+    if (slot == CGPU_INVALID_PUSH_CONSTANT_SLOT)
+    {
+        cgpu_error(&RS->super.device->adapter->instance->logger, "Push constant %s not found in root signature!\n", name ? name : "(null)");
+    }
+    return slot;
+}
+
 void cgpu_compute_encoder_push_constants_vulkan(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
     CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)rs;
-    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)rs->device;
-    D->mVkDeviceTable.vkCmdPushConstants(Cmd->pVkCmdBuf, RS->pPipelineLayout,
-    RS->pPushConstRanges[0].stageFlags, 0,
-    RS->pPushConstRanges[0].size, data);
+    const uint32_t slot = VkUtil_ResolvePushConstantSlot(RS, name);
+    if (slot == CGPU_INVALID_PUSH_CONSTANT_SLOT) return;
+    VkUtil_CmdPushConstantRange(Cmd, RS, slot, 0, 0, data);
+}
+
+void cgpu_compute_encoder_push_constant_range_vulkan(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data)
+{
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)rs;
+    VkUtil_CmdPushConstantRange(Cmd, RS, slot, offset, size, data);
 }
 
 void cgpu_compute_encoder_bind_pipeline_vulkan(CGPUComputePassEncoderId encoder, CGPUComputePipelineId pipeline)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
     CGPUComputePipeline_Vulkan* PPL = (CGPUComputePipeline_Vulkan*)pipeline;
-    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pipeline->device;
-    D->mVkDeviceTable.vkCmdBindPipeline(Cmd->pVkCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE, PPL->pVkPipeline);
+    VkUtil_CmdBindPipeline(Cmd, VK_PIPELINE_BIND_POINT_COMPUTE, PPL->pVkPipeline);
+    VkUtil_BindBindlessSets(Cmd, (const CGPURootSignature_Vulkan*)pipeline->root_signature, VK_PIPELINE_BIND_POINT_COMPUTE);
 }
 
 void cgpu_compute_encoder_dispatch_vulkan(CGPUComputePassEncoderId encoder, uint32_t X, uint32_t Y, uint32_t Z)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
     D->mVkDeviceTable.vkCmdDispatch(Cmd->pVkCmdBuf, X, Y, Z);
 }
 
+void cgpu_compute_encoder_dispatch_indirect_vulkan(CGPUComputePassEncoderId encoder, CGPUBufferId buffer, uint64_t offset)
+{
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)Cmd->super.device;
+    D->mVkDeviceTable.vkCmdDispatchIndirect(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset);
+}
+
 void cgpu_cmd_end_compute_pass_vulkan(CGPUCommandBufferId cmd, CGPUComputePassEncoderId encoder)
 {
     // DO NOTHING NOW
@@ -2078,6 +3319,7 @@ void cgpu_cmd_end_compute_pass_vulkan(CGPUCommandBufferId cmd, CGPUComputePassEn
 CGPURenderPassEncoderId cgpu_cmd_begin_render_pass_vulkan(CGPUCommandBufferId cmd, const CGPUBeginRenderPassInfo* begin_info)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CGPURenderPass_Vulkan* R = (CGPURenderPass_Vulkan*)begin_info->render_pass;
     CGPUFramebuffer_Vulkan* F = (CGPUFramebuffer_Vulkan*)begin_info->framebuffer;
@@ -2121,7 +3363,9 @@ CGPURenderPassEncoderId cgpu_cmd_begin_render_pass_vulkan(CGPUCommandBufferId cm
         .clearValueCount = clearCount,
         .pClearValues = clearValues
     };
-    D->mVkDeviceTable.vkCmdBeginRenderPass(Cmd->pVkCmdBuf, &vk_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    const VkSubpassContents contents = (begin_info->contents == CGPU_RENDER_PASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) ?
+        VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+    D->mVkDeviceTable.vkCmdBeginRenderPass(Cmd->pVkCmdBuf, &vk_begin_info, contents);
     Cmd->pRenderPass = render_pass;
     return (CGPURenderPassEncoderId)cmd;
 }
@@ -2138,7 +3382,15 @@ void cgpu_render_encoder_set_viewport_vulkan(CGPURenderPassEncoderId encoder, fl
         .minDepth = min_depth,
         .maxDepth = max_depth
     };
+    if (Cmd->mViewportValid && memcmp(&Cmd->mViewport, &viewport, sizeof(viewport)) == 0)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
+    }
     D->mVkDeviceTable.vkCmdSetViewport(Cmd->pVkCmdBuf, 0, 1, &viewport);
+    Cmd->mViewport = viewport;
+    Cmd->mViewportValid = true;
+    Cmd->mEmittedStateCalls++;
 }
 
 void cgpu_render_encoder_set_shading_rate_vulkan(CGPURenderPassEncoderId encoder, ECGPUShadingRate shading_rate, ECGPUShadingRateCombiner post_rasterizer_rate, ECGPUShadingRateCombiner final_rate)
@@ -2180,15 +3432,23 @@ void cgpu_render_encoder_set_scissor_vulkan(CGPURenderPassEncoderId encoder, uin
             .height = height,
         },
     };
+    if (Cmd->mScissorValid && memcmp(&Cmd->mScissor, &scissor, sizeof(scissor)) == 0)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
+    }
     D->mVkDeviceTable.vkCmdSetScissor(Cmd->pVkCmdBuf, 0, 1, &scissor);
+    Cmd->mScissor = scissor;
+    Cmd->mScissorValid = true;
+    Cmd->mEmittedStateCalls++;
 }
 
 void cgpu_render_encoder_bind_pipeline_vulkan(CGPURenderPassEncoderId encoder, CGPURenderPipelineId pipeline)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
     CGPURenderPipeline_Vulkan* PPL = (CGPURenderPipeline_Vulkan*)pipeline;
-    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pipeline->device;
-    D->mVkDeviceTable.vkCmdBindPipeline(Cmd->pVkCmdBuf, VK_PIPELINE_BIND_POINT_GRAPHICS, PPL->pVkPipeline);
+    VkUtil_CmdBindPipeline(Cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, PPL->pVkPipeline);
+    VkUtil_BindBindlessSets(Cmd, (const CGPURootSignature_Vulkan*)pipeline->root_signature, VK_PIPELINE_BIND_POINT_GRAPHICS);
 }
 
 void cgpu_render_encoder_bind_vertex_buffers_vulkan(CGPURenderPassEncoderId encoder, uint32_t buffer_count,
@@ -2203,13 +3463,34 @@ const CGPUBufferId* buffers, const uint32_t* strides, const uint32_t* offsets)
     CGPU_DECLARE_ZERO(VkBuffer, vkBuffers[64]);
     CGPU_DECLARE_ZERO(VkDeviceSize, vkOffsets[64]);
 
+    // Only the span of bindings that differ from the shadow is rebound
+    uint32_t first_dirty = final_buffer_count;
+    uint32_t end_dirty = 0;
     for (uint32_t i = 0; i < final_buffer_count; ++i)
     {
         vkBuffers[i] = Buffers[i]->pVkBuffer;
         vkOffsets[i] = (offsets ? offsets[i] : 0);
+        if (i >= CGPU_VK_SHADOWED_VERTEX_BUFFER_COUNT ||
+            Cmd->pVertexBuffers[i] != vkBuffers[i] || Cmd->mVertexBufferOffsets[i] != vkOffsets[i])
+        {
+            first_dirty = cgpu_min(first_dirty, i);
+            end_dirty = i + 1;
+        }
+    }
+    if (first_dirty == final_buffer_count)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
     }
 
-    D->mVkDeviceTable.vkCmdBindVertexBuffers(Cmd->pVkCmdBuf, 0, final_buffer_count, vkBuffers, vkOffsets);
+    D->mVkDeviceTable.vkCmdBindVertexBuffers(Cmd->pVkCmdBuf, first_dirty, end_dirty - first_dirty,
+        vkBuffers + first_dirty, vkOffsets + first_dirty);
+    for (uint32_t i = first_dirty; i < cgpu_min(end_dirty, CGPU_VK_SHADOWED_VERTEX_BUFFER_COUNT); ++i)
+    {
+        Cmd->pVertexBuffers[i] = vkBuffers[i];
+        Cmd->mVertexBufferOffsets[i] = vkOffsets[i];
+    }
+    Cmd->mEmittedStateCalls++;
 }
 
 void cgpu_render_encoder_bind_index_buffer_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer,
@@ -2227,23 +3508,39 @@ uint32_t index_stride, uint64_t offset)
     (sizeof(uint16_t) == index_stride) ?
     VK_INDEX_TYPE_UINT16 :
     ((sizeof(uint8_t) == index_stride) ? VK_INDEX_TYPE_UINT8_EXT : VK_INDEX_TYPE_UINT32);
+    if (Cmd->pIndexBuffer == Buffer->pVkBuffer && Cmd->mIndexBufferOffset == offset && Cmd->mIndexType == vk_index_type)
+    {
+        Cmd->mElidedStateCalls++;
+        return;
+    }
     D->mVkDeviceTable.vkCmdBindIndexBuffer(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset, vk_index_type);
+    Cmd->pIndexBuffer = Buffer->pVkBuffer;
+    Cmd->mIndexBufferOffset = offset;
+    Cmd->mIndexType = vk_index_type;
+    Cmd->mEmittedStateCalls++;
 }
 
 void cgpu_render_encoder_push_constants_vulkan(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
     CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)rs;
-    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)rs->device;
-    D->mVkDeviceTable.vkCmdPushConstants(Cmd->pVkCmdBuf, RS->pPipelineLayout,
-        RS->pPushConstRanges[0].stageFlags, 0,
-        RS->pPushConstRanges[0].size, data);
+    const uint32_t slot = VkUtil_ResolvePushConstantSlot(RS, name);
+    if (slot == CGPU_INVALID_PUSH_CONSTANT_SLOT) return;
+    VkUtil_CmdPushConstantRange(Cmd, RS, slot, 0, 0, data);
+}
+
+void cgpu_render_encoder_push_constant_range_vulkan(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data)
+{
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    CGPURootSignature_Vulkan* RS = (CGPURootSignature_Vulkan*)rs;
+    VkUtil_CmdPushConstantRange(Cmd, RS, slot, offset, size, data);
 }
 
 void cgpu_render_encoder_draw_vulkan(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex)
 {
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
     D->mVkDeviceTable.vkCmdDraw(Cmd->pVkCmdBuf, vertex_count, 1, first_vertex, 0);
 }
 
@@ -2251,6 +3548,7 @@ void cgpu_render_encoder_draw_instanced_vulkan(CGPURenderPassEncoderId encoder,
 {
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
     D->mVkDeviceTable.vkCmdDraw(Cmd->pVkCmdBuf, vertex_count, instance_count, first_vertex, first_instance);
 }
 
@@ -2258,6 +3556,7 @@ void cgpu_render_encoder_draw_indexed_vulkan(CGPURenderPassEncoderId encoder, ui
 {
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
     D->mVkDeviceTable.vkCmdDrawIndexed(Cmd->pVkCmdBuf, index_count, 1, first_index, first_vertex, 0);
 }
 
@@ -2265,9 +3564,97 @@ void cgpu_render_encoder_draw_indexed_instanced_vulkan(CGPURenderPassEncoderId e
 {
     const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
     D->mVkDeviceTable.vkCmdDrawIndexed(Cmd->pVkCmdBuf, index_count, instance_count, first_index, first_vertex, first_instance);
 }
 
+void cgpu_render_encoder_draw_indirect_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    const CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    if (!A->adapter_detail.multidraw_indirect && draw_count > 1)
+    {
+        // Without multiDrawIndirect every draw is its own command
+        for (uint32_t i = 0; i < draw_count; i++)
+            D->mVkDeviceTable.vkCmdDrawIndirect(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset + (uint64_t)i * stride, 1, stride);
+        return;
+    }
+    D->mVkDeviceTable.vkCmdDrawIndirect(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset, draw_count, stride);
+}
+
+void cgpu_render_encoder_draw_indexed_indirect_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    const CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    if (!A->adapter_detail.multidraw_indirect && draw_count > 1)
+    {
+        for (uint32_t i = 0; i < draw_count; i++)
+            D->mVkDeviceTable.vkCmdDrawIndexedIndirect(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset + (uint64_t)i * stride, 1, stride);
+        return;
+    }
+    D->mVkDeviceTable.vkCmdDrawIndexedIndirect(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset, draw_count, stride);
+}
+
+void cgpu_render_encoder_draw_indirect_count_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    const CGPUBuffer_Vulkan* CountBuffer = (const CGPUBuffer_Vulkan*)count_buffer;
+    const CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+#if VK_KHR_draw_indirect_count
+    if (A->draw_indirect_count)
+    {
+        D->mVkDeviceTable.vkCmdDrawIndirectCountKHR(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset,
+            CountBuffer->pVkBuffer, count_buffer_offset, max_draw_count, stride);
+        return;
+    }
+#endif
+#if VK_AMD_draw_indirect_count
+    if (A->amd_draw_indirect_count)
+    {
+        D->mVkDeviceTable.vkCmdDrawIndirectCountAMD(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset,
+            CountBuffer->pVkBuffer, count_buffer_offset, max_draw_count, stride);
+        return;
+    }
+#endif
+    cgpu_error(&A->super.instance->logger, "Draw indirect count is not supported by the adapter!\n");
+}
+
+void cgpu_render_encoder_draw_indexed_indirect_count_vulkan(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+    const CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)encoder->device;
+    CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)encoder;
+    VkUtil_FlushBarriers(Cmd);
+    const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)buffer;
+    const CGPUBuffer_Vulkan* CountBuffer = (const CGPUBuffer_Vulkan*)count_buffer;
+    const CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+#if VK_KHR_draw_indirect_count
+    if (A->draw_indirect_count)
+    {
+        D->mVkDeviceTable.vkCmdDrawIndexedIndirectCountKHR(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset,
+            CountBuffer->pVkBuffer, count_buffer_offset, max_draw_count, stride);
+        return;
+    }
+#endif
+#if VK_AMD_draw_indirect_count
+    if (A->amd_draw_indirect_count)
+    {
+        D->mVkDeviceTable.vkCmdDrawIndexedIndirectCountAMD(Cmd->pVkCmdBuf, Buffer->pVkBuffer, offset,
+            CountBuffer->pVkBuffer, count_buffer_offset, max_draw_count, stride);
+        return;
+    }
+#endif
+    cgpu_error(&A->super.instance->logger, "Draw indirect count is not supported by the adapter!\n");
+}
+
 void cgpu_cmd_end_render_pass_vulkan(CGPUCommandBufferId cmd, CGPURenderPassEncoderId encoder)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
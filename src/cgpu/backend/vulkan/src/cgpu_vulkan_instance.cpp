@@ -109,8 +109,17 @@ struct CGPUVkExtensionsTable : public phmap::flat_hash_map<std::string, bool, st
 #endif
                 Adapter.draw_indirect_count = Table[VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME];
                 Adapter.amd_draw_indirect_count = Table[VK_AMD_DRAW_INDIRECT_COUNT_EXTENSION_NAME];
+                Adapter.adapter_detail.support_draw_indirect_count = Adapter.draw_indirect_count || Adapter.amd_draw_indirect_count;
                 Adapter.amd_gcn_shader = Table[VK_AMD_GCN_SHADER_EXTENSION_NAME];
                 Adapter.sampler_ycbcr = Table[VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME];
+#if VK_KHR_timeline_semaphore
+                Adapter.timeline_semaphore = (Table[VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME] || I->apiVersion >= VK_API_VERSION_1_2) &&
+                                             Adapter.mPhysicalDeviceTimelineSemaphoreFeatures.timelineSemaphore;
+#endif
+#if VK_KHR_synchronization2
+                Adapter.synchronization2 = (Table[VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME] || I->apiVersion >= VK_API_VERSION_1_3) &&
+                                           Adapter.mPhysicalDeviceSynchronization2Features.synchronization2;
+#endif
                 
 #ifdef ENABLE_NSIGHT_AFTERMATH
                 Adapter.nv_diagnostic_checkpoints = Table[VK_NV_DEVICE_DIAGNOSTIC_CHECKPOINTS_EXTENSION_NAME];
@@ -462,13 +471,13 @@ CGPUDeviceId cgpu_create_device_vulkan(CGPUAdapterId adapter, const CGPUDeviceDe
     D->pPipelineCache = VK_NULL_HANDLE;
     if (!desc->disable_pipeline_cache)
     {
-        VkUtil_CreatePipelineCache(D);
+        VkUtil_CreatePipelineCache(D, desc->p_pipeline_cache_data, desc->pipeline_cache_data_size);
     }
 
     // Create VMA Allocator
     VkUtil_CreateVMAAllocator(I, A, D);
-    // Create Descriptor Heap
-    D->pDescriptorPool = VkUtil_CreateDescriptorPool(D);
+    // Create Descriptor Heap, the other shards are created on first use of their threads
+    D->pDescriptorPools[0] = VkUtil_CreateDescriptorPool(D, 0);
 
     // Create the shared empty descriptor set layout + descriptor set. Every root
     // signature uses this to fill set slots that are numbering gaps (never referenced
@@ -483,8 +492,26 @@ CGPUDeviceId cgpu_create_device_vulkan(CGPUAdapterId adapter, const CGPUDeviceDe
         };
         CHECK_VKRESULT(&adapter->instance->logger, D->mVkDeviceTable.vkCreateDescriptorSetLayout(
             D->pVkDevice, &emptyLayoutInfo, &I->vkAllocator, &D->pEmptySetLayout));
-        VkUtil_ConsumeDescriptorSets(D->pDescriptorPool, &D->pEmptySetLayout,
-            &D->pEmptyDescSet, 1);
+        D->pEmptyDescPool = VkUtil_ConsumeDescriptorSets(D->pDescriptorPools[0], &D->pEmptySetLayout,
+            NULL, &D->pEmptyDescSet, 1);
+    }
+    if (desc->bindless_texture_count || desc->bindless_buffer_count)
+    {
+        D->pBindlessHeap = VkUtil_CreateBindlessHeap(D, desc->bindless_texture_count, desc->bindless_buffer_count);
+    }
+    // Descriptor buffer path, root signatures fall back to descriptor sets if this stays null
+    D->pDescriptorBuffer = VkUtil_CreateDescriptorBuffer(D);
+    if (D->pDescriptorBuffer)
+    {
+        VkDescriptorSetLayoutCreateInfo emptyLayoutInfo = {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+            .pNext = NULL,
+            .flags = CGPU_VK_DESCRIPTOR_BUFFER_LAYOUT_FLAGS,
+            .bindingCount = 0,
+            .pBindings = NULL,
+        };
+        CHECK_VKRESULT(&adapter->instance->logger, D->mVkDeviceTable.vkCreateDescriptorSetLayout(
+            D->pVkDevice, &emptyLayoutInfo, &I->vkAllocator, &D->pEmptyDescriptorBufferSetLayout));
     }
 
     VkUtil_EnsureFeatures(A, D);
@@ -492,6 +519,33 @@ CGPUDeviceId cgpu_create_device_vulkan(CGPUAdapterId adapter, const CGPUDeviceDe
     return &D->super;
 }
 
+size_t cgpu_get_pipeline_cache_data_vulkan(CGPUDeviceId device, size_t size, void* data)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    if (D->pPipelineCache == VK_NULL_HANDLE) return 0;
+
+    // query required size if data is null, like vkGetPipelineCacheData
+    size_t dataSize = data ? size : 0;
+    VkResult result = D->mVkDeviceTable.vkGetPipelineCacheData(D->pVkDevice, D->pPipelineCache, &dataSize, data);
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+    {
+        cgpu_warn(&device->adapter->instance->logger, "Failed to get pipeline cache data with VkResult: %d\n", (int32_t)result);
+        return 0;
+    }
+    return dataSize;
+}
+
+void cgpu_query_descriptor_pool_stats_vulkan(CGPUDeviceId device, CGPUDescriptorPoolStats* stats)
+{
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
+    memset(stats, 0, sizeof(CGPUDescriptorPoolStats));
+    for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_POOL_SHARD_COUNT; i++)
+    {
+        VkUtil_DescriptorPool* Pool = (VkUtil_DescriptorPool*)skr_atomicuptr_load_acquire((SAtomicUPtr*)&D->pDescriptorPools[i]);
+        if (Pool) VkUtil_QueryDescriptorPoolStats(Pool, stats);
+    }
+}
+
 void cgpu_free_device_vulkan(CGPUAdapterId adapter, CGPUDeviceId device)
 {
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)device;
@@ -510,10 +564,19 @@ void cgpu_free_device_vulkan(CGPUAdapterId adapter, CGPUDeviceId device)
             cgpu_free(allocator, D->pExternalMemoryVmaPoolNexts[i]);
         }
     }
+    if (D->pDescriptorBuffer)
+    {
+        D->mVkDeviceTable.vkDestroyDescriptorSetLayout(D->pVkDevice, D->pEmptyDescriptorBufferSetLayout, &I->vkAllocator);
+        VkUtil_FreeDescriptorBuffer(D->pDescriptorBuffer);
+    }
     VkUtil_FreeVMAAllocator(I, A, D);
-    VkUtil_ReturnDescriptorSets(D->pDescriptorPool, &D->pEmptyDescSet, 1);
+    VkUtil_ReturnDescriptorSets(D->pDescriptorPools[0], D->pEmptyDescPool, NULL, &D->pEmptyDescSet, 1);
     D->mVkDeviceTable.vkDestroyDescriptorSetLayout(D->pVkDevice, D->pEmptySetLayout, &I->vkAllocator);
-    VkUtil_FreeDescriptorPool(D->pDescriptorPool);
+    if (D->pBindlessHeap) VkUtil_FreeBindlessHeap(D->pBindlessHeap);
+    for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_POOL_SHARD_COUNT; i++)
+    {
+        if (D->pDescriptorPools[i]) VkUtil_FreeDescriptorPool(D->pDescriptorPools[i]);
+    }
     VkUtil_FreePipelineCache(I, A, D);
     vkDestroyDevice(D->pVkDevice, &I->vkAllocator);
     cgpu_free(allocator, D);
@@ -12,7 +12,7 @@
 #endif
 #include <string.h>
 
-CGPU_FORCEINLINE static VkBufferCreateInfo VkUtil_CreateBufferCreateInfo(CGPUAdapter_Vulkan* A, const struct CGPUBufferDescriptor* desc)
+CGPU_FORCEINLINE static VkBufferCreateInfo VkUtil_CreateBufferCreateInfo(CGPUDevice_Vulkan* D, CGPUAdapter_Vulkan* A, const struct CGPUBufferDescriptor* desc)
 {
     uint64_t allocationSize = desc->size;
     // Align the buffer size to multiples of the dynamic uniform buffer minimum size
@@ -35,6 +35,10 @@ CGPU_FORCEINLINE static VkBufferCreateInfo VkUtil_CreateBufferCreateInfo(CGPUAda
     // Buffer can be used as dest in a transfer command (Uploading data to a storage buffer, Readback query data)
     if (desc->memory_usage == CGPU_MEMORY_USAGE_GPU_ONLY || desc->memory_usage == CGPU_MEMORY_USAGE_GPU_TO_CPU)
         add_info.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    // Descriptor buffer path references shader visible buffers by device address
+    if (D->pDescriptorBuffer && (desc->descriptors & (CGPU_RESOURCE_TYPE_UNIFORM_BUFFER | CGPU_RESOURCE_TYPE_BUFFER | CGPU_RESOURCE_TYPE_RW_BUFFER |
+        CGPU_RESOURCE_TYPE_BUFFER_RAW | CGPU_RESOURCE_TYPE_RW_BUFFER_RAW)))
+        add_info.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
     return add_info;
 }
 
@@ -108,7 +112,7 @@ CGPUBufferId cgpu_create_buffer_vulkan(CGPUDeviceId device, const struct CGPUBuf
     CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
     const CGPUAllocator* allocator = &I->super.allocator;
     // Create VkBufferCreateInfo
-    VkBufferCreateInfo add_info = VkUtil_CreateBufferCreateInfo(A, desc);
+    VkBufferCreateInfo add_info = VkUtil_CreateBufferCreateInfo(D, A, desc);
     // VMA Alloc
     VmaAllocationCreateInfo vma_mem_reqs = {
         .usage = (VmaMemoryUsage)desc->memory_usage
@@ -137,6 +141,9 @@ CGPUBufferId cgpu_create_buffer_vulkan(CGPUDeviceId device, const struct CGPUBuf
                                  VMA_MEMORY_USAGE_AUTO;
         vma_mem_reqs.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
     }
+    // Pools fix the memory type, usage and preferred flags above are then ignored by VMA
+    if (desc->memory_pool)
+        vma_mem_reqs.pool = ((CGPUMemoryPool_Vulkan*)desc->memory_pool)->pVmaPool;
     CGPU_DECLARE_ZERO(VmaAllocationInfo, alloc_info)
     VkBuffer pVkBuffer = VK_NULL_HANDLE;
     VmaAllocation mVmaAllocation = VK_NULL_HANDLE;
@@ -159,6 +166,17 @@ CGPUBufferId cgpu_create_buffer_vulkan(CGPUDeviceId device, const struct CGPUBuf
     B->super.info = info;
     B->pVkAllocation = mVmaAllocation;
     B->pVkBuffer = pVkBuffer;
+    if (add_info.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        VkBufferDeviceAddressInfo address_info = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+            .pNext = NULL,
+            .buffer = pVkBuffer
+        };
+        B->mDeviceAddress = D->mVkDeviceTable.vkGetBufferDeviceAddress ?
+            D->mVkDeviceTable.vkGetBufferDeviceAddress(D->pVkDevice, &address_info) :
+            D->mVkDeviceTable.vkGetBufferDeviceAddressKHR(D->pVkDevice, &address_info);
+    }
 
     // Set Buffer Object Props
     info->size = desc->size;
@@ -222,32 +240,7 @@ CGPUBufferId cgpu_create_buffer_vulkan(CGPUDeviceId device, const struct CGPUBuf
     CGPUQueue_Vulkan* Q = (CGPUQueue_Vulkan*)desc->owner_queue;
     if (Q && B->pVkBuffer != VK_NULL_HANDLE && B->pVkAllocation != VK_NULL_HANDLE)
     {
-#ifdef CGPU_THREAD_SAFETY
-        if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
-#endif
-        cgpu_command_pool_reset(Q->pInnerCmdPool);
-        cgpu_command_buffer_begin(Q->pInnerCmdBuffer);
-        CGPUBufferBarrier init_barrier = {
-            .buffer = &B->super,
-            .src_state = CGPU_RESOURCE_STATE_UNDEFINED,
-            .dst_state = desc->start_state
-        };
-        CGPUResourceBarrierDescriptor init_barrier_d = {
-            .buffer_barrier_count = 1,
-            .p_buffer_barriers = &init_barrier,
-        };
-        cgpu_command_buffer_resource_barrier(Q->pInnerCmdBuffer, &init_barrier_d);
-        cgpu_command_buffer_end(Q->pInnerCmdBuffer);
-        CGPUQueueSubmitDescriptor barrier_submit = {
-            .cmd_count = 1,
-            .p_cmds = &Q->pInnerCmdBuffer,
-            .signal_fence = Q->pInnerFence,
-        };
-        cgpu_queue_submit(&Q->super, &barrier_submit);
-        cgpu_wait_fences(1, &Q->pInnerFence);
-#ifdef CGPU_THREAD_SAFETY
-        if (Q->pMutex) skr_mutex_release(Q->pMutex);
-#endif
+        VkUtil_QueueInitialBufferState(Q, B, desc->start_state);
     }
     return &B->super;
 }
@@ -283,9 +276,20 @@ void cgpu_unmap_buffer_vulkan(CGPUBufferId buffer)
     pInfo->cpu_mapped_address = CGPU_NULLPTR;
 }
 
+void cgpu_invalidate_buffer_vulkan(CGPUBufferId buffer, const struct CGPUBufferRange* range)
+{
+    CGPUBuffer_Vulkan* B = (CGPUBuffer_Vulkan*)buffer;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)B->super.device;
+    // VMA rounds the range to nonCoherentAtomSize and skips coherent memory types
+    const VkDeviceSize offset = range ? range->offset : 0;
+    const VkDeviceSize size = (range && range->size) ? range->size : VK_WHOLE_SIZE;
+    CHECK_VKRESULT(&buffer->device->adapter->instance->logger, vmaInvalidateAllocation(D->pVmaAllocator, B->pVkAllocation, offset, size));
+}
+
 void cgpu_cmd_transfer_buffer_to_buffer_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToBufferTransfer* desc)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CGPUBuffer_Vulkan* Dst = (CGPUBuffer_Vulkan*)desc->dst;
     CGPUBuffer_Vulkan* Src = (CGPUBuffer_Vulkan*)desc->src;
@@ -300,6 +304,7 @@ void cgpu_cmd_transfer_buffer_to_buffer_vulkan(CGPUCommandBufferId cmd, const st
 void cgpu_cmd_transfer_buffer_to_texture_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToTextureTransfer* desc)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CGPUTexture_Vulkan* Dst = (CGPUTexture_Vulkan*)desc->dst;
     CGPUBuffer_Vulkan* Src = (CGPUBuffer_Vulkan*)desc->src;
@@ -345,6 +350,7 @@ void cgpu_cmd_transfer_buffer_to_texture_vulkan(CGPUCommandBufferId cmd, const s
 void cgpu_cmd_transfer_buffer_to_tiles_vulkan(CGPUCommandBufferId cmd, const struct CGPUBufferToTilesTransfer* desc)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     const CGPUTexture_Vulkan* Dst = (const CGPUTexture_Vulkan*)desc->dst;
     CGPUBuffer_Vulkan* Src = (CGPUBuffer_Vulkan*)desc->src;
@@ -396,6 +402,7 @@ void cgpu_cmd_transfer_buffer_to_tiles_vulkan(CGPUCommandBufferId cmd, const str
 void cgpu_cmd_transfer_texture_to_texture_vulkan(CGPUCommandBufferId cmd, const struct CGPUTextureToTextureTransfer* desc)
 {
     CGPUCommandBuffer_Vulkan* Cmd = (CGPUCommandBuffer_Vulkan*)cmd;
+    VkUtil_FlushBarriers(Cmd);
     CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)cmd->device;
     CGPUTexture_Vulkan* Dst = (CGPUTexture_Vulkan*)desc->dst;
     CGPUTexture_Vulkan* Src = (CGPUTexture_Vulkan*)desc->src;
@@ -438,6 +445,7 @@ void cgpu_free_buffer_vulkan(CGPUDeviceId device, CGPUBufferId buffer)
     CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
     const CGPUAllocator* allocator = &I->super.allocator;
     cgpu_assert(B->pVkAllocation && "pVkAllocation must not be null!");
+    if (B->pInitQueue) VkUtil_CancelInitialState(B->pInitQueue, B, &B->mInitPending);
     if (B->pVkUniformTexelView)
     {
         vkDestroyBufferView(D->pVkDevice, B->pVkUniformTexelView, &I->vkAllocator);
@@ -874,6 +882,10 @@ CGPUTextureId cgpu_create_texture_vulkan(CGPUDeviceId device, const struct CGPUT
                 {
                     mem_reqs.flags |= VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT;
                 }
+                if (desc->memory_pool && !(desc->flags & CGPU_TEXTURE_CREATION_USAGE_EXPORT))
+                {
+                    mem_reqs.pool = ((CGPUMemoryPool_Vulkan*)desc->memory_pool)->pVmaPool;
+                }
                 VkResult res = vmaCreateImage(D->pVmaAllocator,
                     &imageCreateInfo, &mem_reqs, &pVkImage,
                     &vmaAllocation, &alloc_info);
@@ -960,32 +972,7 @@ CGPUTextureId cgpu_create_texture_vulkan(CGPUDeviceId device, const struct CGPUT
     // Start state
     if (Q && T->pVkImage != VK_NULL_HANDLE && desc->start_state != CGPU_RESOURCE_STATE_UNDEFINED)
     {
-#ifdef CGPU_THREAD_SAFETY
-        if (Q->pMutex) skr_mutex_acquire(Q->pMutex);
-#endif
-        cgpu_command_pool_reset(Q->pInnerCmdPool);
-        cgpu_command_buffer_begin(Q->pInnerCmdBuffer);
-        CGPUTextureBarrier init_barrier = {
-            .texture = &T->super,
-            .src_state = CGPU_RESOURCE_STATE_UNDEFINED,
-            .dst_state = desc->start_state
-        };
-        CGPUResourceBarrierDescriptor init_barrier_d = {
-            .texture_barrier_count = 1,
-            .p_texture_barriers = &init_barrier,
-        };
-        cgpu_command_buffer_resource_barrier(Q->pInnerCmdBuffer, &init_barrier_d);
-        cgpu_command_buffer_end(Q->pInnerCmdBuffer);
-        CGPUQueueSubmitDescriptor barrier_submit = {
-            .cmd_count = 1,
-            .p_cmds = &Q->pInnerCmdBuffer,
-            .signal_fence = Q->pInnerFence,
-        };
-        cgpu_queue_submit(&Q->super, &barrier_submit);
-        cgpu_wait_fences(1, &Q->pInnerFence);
-#ifdef CGPU_THREAD_SAFETY
-        if (Q->pMutex) skr_mutex_release(Q->pMutex);
-#endif
+        VkUtil_QueueInitialTextureState(Q, T, desc->start_state);
     }
     return &T->super;
 }
@@ -1307,6 +1294,7 @@ void cgpu_free_texture_vulkan(CGPUDeviceId device, CGPUTextureId texture)
     const CGPUAllocator* allocator = &I->super.allocator;
     CGPUTexture_Vulkan* T = (CGPUTexture_Vulkan*)texture;
     const CGPUTextureInfo* pInfo = T->super.info;
+    if (T->pInitQueue) VkUtil_CancelInitialState(T->pInitQueue, T, &T->mInitPending);
     if (T->pVkImage != VK_NULL_HANDLE)
     {
         if (pInfo->is_imported)
@@ -19,6 +19,8 @@ const CGPUProcTable tbl_vk = {
     // Device APIs
     .create_device = &cgpu_create_device_vulkan,
     .free_device = &cgpu_free_device_vulkan,
+    .get_pipeline_cache_data = &cgpu_get_pipeline_cache_data_vulkan,
+    .query_descriptor_pool_stats = &cgpu_query_descriptor_pool_stats_vulkan,
 
     // API Object APIs
     .create_fence = &cgpu_create_fence_vulkan,
@@ -28,6 +30,11 @@ const CGPUProcTable tbl_vk = {
     .free_fence = &cgpu_free_fence_vulkan,
     .create_semaphore = &cgpu_create_semaphore_vulkan,
     .free_semaphore = &cgpu_free_semaphore_vulkan,
+    .create_timeline_semaphore = &cgpu_create_timeline_semaphore_vulkan,
+    .free_timeline_semaphore = &cgpu_free_timeline_semaphore_vulkan,
+    .signal_timeline_semaphore = &cgpu_signal_timeline_semaphore_vulkan,
+    .wait_timeline_semaphores = &cgpu_wait_timeline_semaphores_vulkan,
+    .query_timeline_semaphore_value = &cgpu_query_timeline_semaphore_value_vulkan,
     .create_root_signature_pool = &cgpu_create_root_signature_pool_vulkan,
     .free_root_signature_pool = &cgpu_free_root_signature_pool_vulkan,
     .create_root_signature = &cgpu_create_root_signature_vulkan,
@@ -35,16 +42,29 @@ const CGPUProcTable tbl_vk = {
     .create_descriptor_set = &cgpu_create_descriptor_set_vulkan,
     .free_descriptor_set = &cgpu_free_descriptor_set_vulkan,
     .update_descriptor_set = &cgpu_update_descriptor_set_vulkan,
+    .create_descriptor_arena = &cgpu_create_descriptor_arena_vulkan,
+    .descriptor_arena_allocate_set = &cgpu_descriptor_arena_allocate_set_vulkan,
+    .reset_descriptor_arena = &cgpu_reset_descriptor_arena_vulkan,
+    .free_descriptor_arena = &cgpu_free_descriptor_arena_vulkan,
+    .register_bindless_texture_view = &cgpu_register_bindless_texture_view_vulkan,
+    .register_bindless_buffer = &cgpu_register_bindless_buffer_vulkan,
+    .unregister_bindless_texture_view = &cgpu_unregister_bindless_texture_view_vulkan,
+    .unregister_bindless_buffer = &cgpu_unregister_bindless_buffer_vulkan,
+    .advance_bindless_frame = &cgpu_advance_bindless_frame_vulkan,
     .create_compute_pipeline = &cgpu_create_compute_pipeline_vulkan,
     .free_compute_pipeline = &cgpu_free_compute_pipeline_vulkan,
     .create_render_pipeline = &cgpu_create_render_pipeline_vulkan,
     .free_render_pipeline = &cgpu_free_render_pipeline_vulkan,
+    .create_memory_pool = &cgpu_create_memory_pool_vulkan,
+    .free_memory_pool = &cgpu_free_memory_pool_vulkan,
+    .query_memory_pool_statistics = &cgpu_query_memory_pool_statistics_vulkan,
     .create_query_pool = &cgpu_create_query_pool_vulkan,
     .free_query_pool = &cgpu_free_query_pool_vulkan,
 
     // Queue APIs
     .get_queue = &cgpu_get_queue_vulkan,
     .submit_queue = &cgpu_submit_queue_vulkan,
+    .submit_queue_batches = &cgpu_submit_queue_batches_vulkan,
     .wait_queue_idle = &cgpu_wait_queue_idle_vulkan,
     .queue_present = &cgpu_queue_present_vulkan,
     .queue_get_timestamp_period = &cgpu_queue_get_timestamp_period_ns_vulkan,
@@ -75,6 +95,7 @@ const CGPUProcTable tbl_vk = {
     .create_buffer = &cgpu_create_buffer_vulkan,
     .map_buffer = &cgpu_map_buffer_vulkan,
     .unmap_buffer = &cgpu_unmap_buffer_vulkan,
+    .invalidate_buffer = &cgpu_invalidate_buffer_vulkan,
     .free_buffer = &cgpu_free_buffer_vulkan,
 
     // Sampler APIs
@@ -99,6 +120,8 @@ const CGPUProcTable tbl_vk = {
 
     // CMDs
     .cmd_begin = &cgpu_cmd_begin_vulkan,
+    .cmd_begin_secondary = &cgpu_cmd_begin_secondary_vulkan,
+    .cmd_execute_secondaries = &cgpu_cmd_execute_secondaries_vulkan,
     .cmd_transfer_buffer_to_buffer = &cgpu_cmd_transfer_buffer_to_buffer_vulkan,
     .cmd_transfer_buffer_to_texture = &cgpu_cmd_transfer_buffer_to_texture_vulkan,
     .cmd_transfer_buffer_to_tiles = &cgpu_cmd_transfer_buffer_to_tiles_vulkan,
@@ -109,13 +132,16 @@ const CGPUProcTable tbl_vk = {
     .cmd_reset_query_pool = &cgpu_cmd_reset_query_pool_vulkan,
     .cmd_resolve_query = &cgpu_cmd_resolve_query_vulkan,
     .cmd_end = &cgpu_cmd_end_vulkan,
+    .query_command_buffer_statistics = &cgpu_query_command_buffer_statistics_vulkan,
 
     // Compute CMDs
     .cmd_begin_compute_pass = &cgpu_cmd_begin_compute_pass_vulkan,
     .compute_encoder_bind_descriptor_set = &cgpu_compute_encoder_bind_descriptor_set_vulkan,
     .compute_encoder_push_constants = &cgpu_compute_encoder_push_constants_vulkan,
+    .compute_encoder_push_constant_range = &cgpu_compute_encoder_push_constant_range_vulkan,
     .compute_encoder_bind_pipeline = &cgpu_compute_encoder_bind_pipeline_vulkan,
     .compute_encoder_dispatch = &cgpu_compute_encoder_dispatch_vulkan,
+    .compute_encoder_dispatch_indirect = &cgpu_compute_encoder_dispatch_indirect_vulkan,
     .cmd_end_compute_pass = &cgpu_cmd_end_compute_pass_vulkan,
 
     // Render CMDs
@@ -126,12 +152,17 @@ const CGPUProcTable tbl_vk = {
     .render_encoder_bind_vertex_buffers = &cgpu_render_encoder_bind_vertex_buffers_vulkan,
     .render_encoder_bind_index_buffer = &cgpu_render_encoder_bind_index_buffer_vulkan,
     .render_encoder_push_constants = &cgpu_render_encoder_push_constants_vulkan,
+    .render_encoder_push_constant_range = &cgpu_render_encoder_push_constant_range_vulkan,
     .render_encoder_set_viewport = &cgpu_render_encoder_set_viewport_vulkan,
     .render_encoder_set_scissor = &cgpu_render_encoder_set_scissor_vulkan,
     .render_encoder_draw = &cgpu_render_encoder_draw_vulkan,
     .render_encoder_draw_instanced = &cgpu_render_encoder_draw_instanced_vulkan,
     .render_encoder_draw_indexed = &cgpu_render_encoder_draw_indexed_vulkan,
     .render_encoder_draw_indexed_instanced = &cgpu_render_encoder_draw_indexed_instanced_vulkan,
+    .render_encoder_draw_indirect = &cgpu_render_encoder_draw_indirect_vulkan,
+    .render_encoder_draw_indexed_indirect = &cgpu_render_encoder_draw_indexed_indirect_vulkan,
+    .render_encoder_draw_indirect_count = &cgpu_render_encoder_draw_indirect_count_vulkan,
+    .render_encoder_draw_indexed_indirect_count = &cgpu_render_encoder_draw_indexed_indirect_count_vulkan,
     .cmd_end_render_pass = &cgpu_cmd_end_render_pass_vulkan,
 
     // Events
@@ -203,6 +203,11 @@ const char* const* device_extensions, uint32_t device_extension_count)
                 *ppNext = &VkAdapter->mPhysicalDeviceDescriptorBufferProperties;
                 ppNext = &VkAdapter->mPhysicalDeviceDescriptorBufferProperties.pNext;
 #endif
+#if VK_EXT_descriptor_indexing
+                VkAdapter->mPhysicalDeviceDescriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+                *ppNext = &VkAdapter->mPhysicalDeviceDescriptorIndexingProperties;
+                ppNext = &VkAdapter->mPhysicalDeviceDescriptorIndexingProperties.pNext;
+#endif
 #if VK_KHR_fragment_shading_rate
                 VkAdapter->mPhysicalDeviceFragmentShadingRateProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR;
                 *ppNext = &VkAdapter->mPhysicalDeviceFragmentShadingRateProps;
@@ -223,11 +228,26 @@ const char* const* device_extensions, uint32_t device_extension_count)
                 *ppNext = &VkAdapter->mPhysicalDeviceBufferDeviceAddressFeatures;
                 ppNext = &VkAdapter->mPhysicalDeviceBufferDeviceAddressFeatures.pNext;
 #endif
+#if VK_KHR_timeline_semaphore
+                VkAdapter->mPhysicalDeviceTimelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+                *ppNext = &VkAdapter->mPhysicalDeviceTimelineSemaphoreFeatures;
+                ppNext = &VkAdapter->mPhysicalDeviceTimelineSemaphoreFeatures.pNext;
+#endif
+#if VK_KHR_synchronization2
+                VkAdapter->mPhysicalDeviceSynchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+                *ppNext = &VkAdapter->mPhysicalDeviceSynchronization2Features;
+                ppNext = &VkAdapter->mPhysicalDeviceSynchronization2Features.pNext;
+#endif
 #if VK_EXT_descriptor_buffer
                 VkAdapter->mPhysicalDeviceDescriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
                 *ppNext = &VkAdapter->mPhysicalDeviceDescriptorBufferFeatures;
                 ppNext = &VkAdapter->mPhysicalDeviceDescriptorBufferFeatures.pNext;
 #endif
+#if VK_EXT_descriptor_indexing
+                VkAdapter->mPhysicalDeviceDescriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+                *ppNext = &VkAdapter->mPhysicalDeviceDescriptorIndexingFeatures;
+                ppNext = &VkAdapter->mPhysicalDeviceDescriptorIndexingFeatures.pNext;
+#endif
 
 #if VK_KHR_fragment_shading_rate
                 VkAdapter->mPhysicalDeviceFragmentShadingRateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
@@ -290,21 +310,49 @@ const char* const* device_extensions, uint32_t device_extension_count)
 }
 
 // Device APIs
-void VkUtil_CreatePipelineCache(CGPUDevice_Vulkan* D)
+static bool VkUtil_ValidatePipelineCacheData(CGPUAdapter_Vulkan* A, const void* pData, size_t dataSize)
+{
+    const VkPhysicalDeviceProperties* props = &A->mPhysicalDeviceProps.properties;
+    VkPipelineCacheHeaderVersionOne header;
+    if (dataSize < sizeof(header)) return false;
+    // blob may come from an unaligned file buffer
+    memcpy(&header, pData, sizeof(header));
+    if (header.headerSize < sizeof(header) || header.headerSize > dataSize) return false;
+    if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) return false;
+    if (header.vendorID != props->vendorID || header.deviceID != props->deviceID) return false;
+    return memcmp(header.pipelineCacheUUID, props->pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void VkUtil_CreatePipelineCache(CGPUDevice_Vulkan* D, const void* pInitialData, size_t initialDataSize)
 {
     cgpu_assert((D->pPipelineCache == VK_NULL_HANDLE) && "VkUtil_CreatePipelineCache should be called only once!");
     CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
     CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
 
-    // TODO: serde
+    // Drivers are expected to reject foreign blobs, but some crash instead, so check the header first.
+    if (pInitialData && initialDataSize && !VkUtil_ValidatePipelineCacheData(A, pInitialData, initialDataSize))
+    {
+        cgpu_warn(&I->super.logger, "Pipeline cache data mismatches the adapter or driver, fallback to an empty cache!\n");
+        pInitialData = NULL;
+        initialDataSize = 0;
+    }
     VkPipelineCacheCreateInfo info = {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
         .pNext = NULL,
-        .initialDataSize = 0,
-        .pInitialData = NULL
+        .initialDataSize = pInitialData ? initialDataSize : 0,
+        .pInitialData = pInitialData
     };
-    D->mVkDeviceTable.vkCreatePipelineCache(D->pVkDevice,
+    VkResult result = D->mVkDeviceTable.vkCreatePipelineCache(D->pVkDevice,
     &info, &I->vkAllocator, &D->pPipelineCache);
+    if (result != VK_SUCCESS && info.pInitialData)
+    {
+        cgpu_warn(&I->super.logger, "Failed to create pipeline cache from initial data, fallback to an empty cache!\n");
+        info.initialDataSize = 0;
+        info.pInitialData = NULL;
+        D->pPipelineCache = VK_NULL_HANDLE;
+        D->mVkDeviceTable.vkCreatePipelineCache(D->pVkDevice,
+        &info, &I->vkAllocator, &D->pPipelineCache);
+    }
 }
 
 // Shader Reflection
@@ -457,7 +505,13 @@ void VkUtil_InitializeShaderReflection(CGPUDeviceId device, CGPUShaderLibrary_Vu
                 current_res->set = 0;
                 current_res->type = CGPU_RESOURCE_TYPE_PUSH_CONSTANT;
                 current_res->binding = 0;
-                current_res->name = push_constants_name;
+                // Variable name first ("pc"), then the block type name, for shaders compiled without debug names
+                if (root_sets[i]->name && root_sets[i]->name[0])
+                    current_res->name = root_sets[i]->name;
+                else if (root_sets[i]->type_description && root_sets[i]->type_description->type_name && root_sets[i]->type_description->type_name[0])
+                    current_res->name = root_sets[i]->type_description->type_name;
+                else
+                    current_res->name = push_constants_name;
                 current_res->name_hash =
                     cgpu_name_hash(current_res->name, strlen(current_res->name));
                 current_res->stages = S->pReflect->shader_stage;
@@ -523,6 +577,13 @@ void VkUtil_CreateVMAAllocator(CGPUInstance_Vulkan* I, CGPUAdapter_Vulkan* A, CG
     {
         vmaInfo.flags |= VMA_ALLOCATOR_CREATE_KHR_DEDICATED_ALLOCATION_BIT;
     }
+#endif
+#if VK_KHR_buffer_device_address
+    // Needed by the descriptor buffer path, which takes device addresses of buffers
+    if (A->buffer_device_address && A->mPhysicalDeviceBufferDeviceAddressFeatures.bufferDeviceAddress)
+    {
+        vmaInfo.flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
 #endif
     if (vmaCreateAllocator(&vmaInfo, &D->pVmaAllocator) != VK_SUCCESS)
     {
@@ -562,7 +623,59 @@ void VkUtil_EnsureFeatures(CGPUAdapter_Vulkan* A, CGPUDevice_Vulkan* D)
 }
 
 // API Objects Helpers
-struct VkUtil_DescriptorPool* VkUtil_CreateDescriptorPool(CGPUDevice_Vulkan* D)
+// pRequiredCounts and requiredSets describe the allocation that triggered the grow, the block always fits it
+static bool VkUtil_AddDescriptorPoolBlock(VkUtil_DescriptorPool* Pool, const uint32_t* pRequiredCounts, uint32_t requiredSets)
+{
+    CGPUDevice_Vulkan* D = Pool->Device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    if (Pool->mBlockCount == Pool->mBlockCapacity)
+    {
+        const uint32_t newCapacity = cgpu_max(4u, Pool->mBlockCapacity * 2);
+        VkUtil_DescriptorPoolBlock* newBlocks = (VkUtil_DescriptorPoolBlock*)cgpu_realloc(allocator,
+            Pool->pBlocks, newCapacity * sizeof(VkUtil_DescriptorPoolBlock));
+        if (!newBlocks) return false;
+        Pool->pBlocks = newBlocks;
+        Pool->mBlockCapacity = newCapacity;
+    }
+    // The first block uses the default sizes, later blocks are scaled from the
+    // average per-set usage of each descriptor type observed so far.
+    const uint32_t maxSets = cgpu_max((uint32_t)CGPU_VK_DESCRIPTOR_POOL_MAX_SETS, requiredSets);
+    VkDescriptorPoolSize poolSizes[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE];
+    for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE; i++)
+    {
+        poolSizes[i] = gDescriptorPoolSizes[i];
+        if (Pool->mAllocatedSets)
+        {
+            const uint64_t expected = (Pool->mDescriptorUsage[i] * maxSets + Pool->mAllocatedSets - 1) / Pool->mAllocatedSets;
+            poolSizes[i].descriptorCount = (uint32_t)cgpu_min(cgpu_max((uint64_t)poolSizes[i].descriptorCount, expected), (uint64_t)UINT32_MAX);
+        }
+        if (pRequiredCounts)
+            poolSizes[i].descriptorCount = cgpu_max(poolSizes[i].descriptorCount, pRequiredCounts[i]);
+    }
+    VkDescriptorPoolCreateInfo poolCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext = NULL,
+        .flags = Pool->mFlags,
+        .maxSets = maxSets,
+        .poolSizeCount = CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE,
+        .pPoolSizes = poolSizes,
+    };
+    VkUtil_DescriptorPoolBlock* Block = &Pool->pBlocks[Pool->mBlockCount];
+    VkResult vk_res = D->mVkDeviceTable.vkCreateDescriptorPool(D->pVkDevice, &poolCreateInfo, &I->vkAllocator, &Block->pVkDescPool);
+    if (vk_res != VK_SUCCESS)
+    {
+        cgpu_error(&I->super.logger, "Failed to create descriptor pool block with VkResult: %d\n", (int32_t)vk_res);
+        return false;
+    }
+    Block->mMaxSets = maxSets;
+    Block->mAllocatedSets = 0;
+    Pool->mCurrentBlock = Pool->mBlockCount++;
+    return true;
+}
+
+struct VkUtil_DescriptorPool* VkUtil_CreateDescriptorPool(CGPUDevice_Vulkan* D, uint32_t shardIndex)
 {
     CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
     CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
@@ -577,56 +690,255 @@ struct VkUtil_DescriptorPool* VkUtil_CreateDescriptorPool(CGPUDevice_Vulkan* D)
     flags |= VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
     Pool->Device = D;
     Pool->mFlags = flags;
-    VkDescriptorPoolCreateInfo poolCreateInfo = {
-        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-        .pNext = NULL,
-        .flags = Pool->mFlags,
-        .maxSets = 8192,
-        .poolSizeCount = CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE,
-        .pPoolSizes = gDescriptorPoolSizes,
-    };
-    CHECK_VKRESULT(&D->super.adapter->instance->logger, D->mVkDeviceTable.vkCreateDescriptorPool(
-        D->pVkDevice, &poolCreateInfo, &I->vkAllocator, &Pool->pVkDescPool));
+    Pool->mShardIndex = shardIndex;
+    if (!VkUtil_AddDescriptorPoolBlock(Pool, CGPU_NULLPTR, 0))
+    {
+        cgpu_assert(0 && "Failed to create vk descriptor pool!");
+    }
     return Pool;
 }
 
-void VkUtil_ConsumeDescriptorSets(struct VkUtil_DescriptorPool* pPool,
-const VkDescriptorSetLayout* pLayouts, VkDescriptorSet* pSets, uint32_t numDescriptorSets)
+#ifdef CGPU_THREAD_SAFETY
+// Threads are assigned to shards round-robin on their first descriptor allocation
+static SAtomicU32 gDescriptorPoolShardCounter = 0;
+static CGPU_THREAD_LOCAL uint32_t tDescriptorPoolShard = UINT32_MAX;
+#endif
+
+CGPU_FORCEINLINE static uint32_t VkUtil_CurrentDescriptorPoolShard()
 {
+#ifdef CGPU_THREAD_SAFETY
+    if (tDescriptorPoolShard == UINT32_MAX)
+    {
+        tDescriptorPoolShard = skr_atomicu32_add_relaxed(&gDescriptorPoolShardCounter, 1) % CGPU_VK_DESCRIPTOR_POOL_SHARD_COUNT;
+    }
+    return tDescriptorPoolShard;
+#else
+    // Shards have no locks in this build, descriptor calls are externally synchronized on one shard
+    return 0;
+#endif
+}
+
+struct VkUtil_DescriptorPool* VkUtil_AcquireDescriptorPoolShard(CGPUDevice_Vulkan* D)
+{
+    const uint32_t shardIndex = VkUtil_CurrentDescriptorPoolShard();
+    VkUtil_DescriptorPool* Pool = (VkUtil_DescriptorPool*)skr_atomicuptr_load_acquire((SAtomicUPtr*)&D->pDescriptorPools[shardIndex]);
+    if (Pool == CGPU_NULLPTR)
+    {
+        // Another thread of the same shard may race us here, the loser frees its pool
+        VkUtil_DescriptorPool* NewPool = VkUtil_CreateDescriptorPool(D, shardIndex);
+        Pool = (VkUtil_DescriptorPool*)skr_atomicuptr_cas_relaxed((SAtomicUPtr*)&D->pDescriptorPools[shardIndex], 0, (uintptr_t)NewPool);
+        if (Pool == CGPU_NULLPTR)
+        {
+            Pool = NewPool;
+        }
+        else
+        {
+            VkUtil_FreeDescriptorPool(NewPool);
+        }
+    }
+    return Pool;
+}
+
+// Must be called with the shard lock held
+static void VkUtil_FreeDescriptorSetsLocked(VkUtil_DescriptorPool* pPool, VkDescriptorPool pVkDescPool,
+const uint32_t* pDescriptorCounts, VkDescriptorSet* pSets, uint32_t numDescriptorSets)
+{
+    // TODO: It is possible to avoid using that flag by updating descriptor sets instead of deleting them.
+    // The application can keep track of recycled descriptor sets and re-use one of them when a new one is requested.
+    // Reference: https://arm-software.github.io/vulkan_best_practice_for_mobile_developers/samples/performance/descriptor_management/descriptor_management_tutorial.html
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pPool->Device;
+    D->mVkDeviceTable.vkFreeDescriptorSets(D->pVkDevice, pVkDescPool, numDescriptorSets, pSets);
+    for (uint32_t i = 0; i < pPool->mBlockCount; i++)
+    {
+        if (pPool->pBlocks[i].pVkDescPool == pVkDescPool)
+        {
+            pPool->pBlocks[i].mAllocatedSets -= numDescriptorSets;
+            break;
+        }
+    }
+    pPool->mAllocatedSets -= numDescriptorSets;
+    if (pDescriptorCounts)
+    {
+        for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE; i++)
+            pPool->mDescriptorUsage[i] -= pDescriptorCounts[i];
+    }
+}
+
+// Must be called with the shard lock held
+static void VkUtil_DrainPendingDescriptorSetFrees(VkUtil_DescriptorPool* pPool)
+{
+    if (!skr_atomicuptr_load_relaxed(&pPool->mPendingFrees)) return;
+    const CGPUAllocator* allocator = &pPool->Device->super.adapter->instance->allocator;
+    VkUtil_PendingDescriptorSetFree* Pending = (VkUtil_PendingDescriptorSetFree*)skr_atomicuptr_store_relaxed(&pPool->mPendingFrees, 0);
+    while (Pending)
+    {
+        VkUtil_PendingDescriptorSetFree* Next = Pending->pNext;
+        VkUtil_FreeDescriptorSetsLocked(pPool, Pending->pVkDescPool, Pending->mDescriptorCounts, Pending->pSets, Pending->mSetCount);
+        cgpu_free(allocator, Pending);
+        Pending = Next;
+    }
+}
+
+VkDescriptorPool VkUtil_ConsumeDescriptorSets(struct VkUtil_DescriptorPool* pPool, const VkDescriptorSetLayout* pLayouts,
+const uint32_t* pDescriptorCounts, VkDescriptorSet* pSets, uint32_t numDescriptorSets)
+{
+    VkDescriptorPool pVkDescPool = VK_NULL_HANDLE;
 #ifdef CGPU_THREAD_SAFETY
     skr_mutex_acquire(pPool->pMutex);
 #endif
     {
         CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pPool->Device;
+        VkUtil_DrainPendingDescriptorSetFrees(pPool);
         VkDescriptorSetAllocateInfo alloc_info = {
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
             .pNext = NULL,
-            .descriptorPool = pPool->pVkDescPool,
+            .descriptorPool = VK_NULL_HANDLE,
             .descriptorSetCount = numDescriptorSets,
             .pSetLayouts = pLayouts
         };
-        VkResult vk_res = D->mVkDeviceTable.vkAllocateDescriptorSets(D->pVkDevice, &alloc_info, pSets);
-        if (vk_res != VK_SUCCESS)
+        // Walk the chain from the last successful block, and grow it if every block is exhausted
+        const uint32_t blockCount = pPool->mBlockCount;
+        uint32_t blockIndex = UINT32_MAX;
+        for (uint32_t i = 0; i <= blockCount; i++)
         {
-            cgpu_assert(0 && "Descriptor Set used out, vk descriptor pool expansion not implemented!");
+            uint32_t candidate = (pPool->mCurrentBlock + i) % blockCount;
+            const uint32_t previousBlock = pPool->mCurrentBlock;
+            if (i == blockCount)
+            {
+                if (!VkUtil_AddDescriptorPoolBlock(pPool, pDescriptorCounts, numDescriptorSets)) break;
+                candidate = pPool->mBlockCount - 1;
+            }
+            VkUtil_DescriptorPoolBlock* Block = &pPool->pBlocks[candidate];
+            if (Block->mAllocatedSets + numDescriptorSets > Block->mMaxSets) continue;
+            alloc_info.descriptorPool = Block->pVkDescPool;
+            VkResult vk_res = D->mVkDeviceTable.vkAllocateDescriptorSets(D->pVkDevice, &alloc_info, pSets);
+            if (vk_res == VK_SUCCESS)
+            {
+                blockIndex = candidate;
+                break;
+            }
+            if (i == blockCount)
+            {
+                // A block sized for the request still failed, keep the chain from growing on every retry
+                CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)D->super.adapter->instance;
+                D->mVkDeviceTable.vkDestroyDescriptorPool(D->pVkDevice, Block->pVkDescPool, &I->vkAllocator);
+                pPool->mBlockCount--;
+                pPool->mCurrentBlock = previousBlock;
+                break;
+            }
+            if (vk_res != VK_ERROR_OUT_OF_POOL_MEMORY && vk_res != VK_ERROR_FRAGMENTED_POOL) break;
+        }
+        if (blockIndex != UINT32_MAX)
+        {
+            VkUtil_DescriptorPoolBlock* Block = &pPool->pBlocks[blockIndex];
+            Block->mAllocatedSets += numDescriptorSets;
+            pPool->mCurrentBlock = blockIndex;
+            pPool->mAllocatedSets += numDescriptorSets;
+            if (pDescriptorCounts)
+            {
+                for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE; i++)
+                    pPool->mDescriptorUsage[i] += pDescriptorCounts[i];
+            }
+            pVkDescPool = Block->pVkDescPool;
+        }
+        else
+        {
+            cgpu_assert(0 && "Failed to allocate descriptor sets from vk descriptor pool chain!");
         }
     }
 #ifdef CGPU_THREAD_SAFETY
     skr_mutex_release(pPool->pMutex);
 #endif
+    return pVkDescPool;
 }
 
-void VkUtil_ReturnDescriptorSets(struct VkUtil_DescriptorPool* pPool, VkDescriptorSet* pSets, uint32_t numDescriptorSets)
+void VkUtil_ReturnDescriptorSets(struct VkUtil_DescriptorPool* pPool, VkDescriptorPool pVkDescPool,
+const uint32_t* pDescriptorCounts, VkDescriptorSet* pSets, uint32_t numDescriptorSets)
 {
+    if (VkUtil_CurrentDescriptorPoolShard() != pPool->mShardIndex)
+    {
+        // Hand the sets back to the owner shard without touching its lock
+        const CGPUAllocator* allocator = &pPool->Device->super.adapter->instance->allocator;
+        VkUtil_PendingDescriptorSetFree* Pending = (VkUtil_PendingDescriptorSetFree*)cgpu_malloc(allocator,
+            sizeof(VkUtil_PendingDescriptorSetFree) + numDescriptorSets * sizeof(VkDescriptorSet));
+        Pending->pVkDescPool = pVkDescPool;
+        Pending->mSetCount = numDescriptorSets;
+        Pending->pSets = (VkDescriptorSet*)(Pending + 1);
+        memcpy(Pending->pSets, pSets, numDescriptorSets * sizeof(VkDescriptorSet));
+        if (pDescriptorCounts)
+            memcpy(Pending->mDescriptorCounts, pDescriptorCounts, sizeof(Pending->mDescriptorCounts));
+        else
+            memset(Pending->mDescriptorCounts, 0, sizeof(Pending->mDescriptorCounts));
+        uintptr_t head = 0;
+        do
+        {
+            head = skr_atomicuptr_load_relaxed(&pPool->mPendingFrees);
+            Pending->pNext = (VkUtil_PendingDescriptorSetFree*)head;
+        } while (skr_atomicuptr_cas_relaxed(&pPool->mPendingFrees, head, (uintptr_t)Pending) != head);
+        // Drain right away when the owner is idle, otherwise its next allocate or free does it.
+        // Without this an owner thread that stopped allocating would keep the sets reserved.
+#ifdef CGPU_THREAD_SAFETY
+        if (skr_mutex_try_acquire(pPool->pMutex))
+        {
+            VkUtil_DrainPendingDescriptorSetFrees(pPool);
+            skr_mutex_release(pPool->pMutex);
+        }
+#endif
+        return;
+    }
 #ifdef CGPU_THREAD_SAFETY
     skr_mutex_acquire(pPool->pMutex);
 #endif
+    VkUtil_DrainPendingDescriptorSetFrees(pPool);
+    VkUtil_FreeDescriptorSetsLocked(pPool, pVkDescPool, pDescriptorCounts, pSets, numDescriptorSets);
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pPool->pMutex);
+#endif
+}
+
+// Pool without FREE_DESCRIPTOR_SET_BIT, sets are only released by vkResetDescriptorPool.
+// Every type covers maxSets sets of the layout that triggered the pool, others keep the scaled defaults.
+VkDescriptorPool VkUtil_CreateTransientDescriptorPool(CGPUDevice_Vulkan* D, uint32_t maxSets, const uint32_t* pSetDescriptorCounts)
+{
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    VkDescriptorPoolSize poolSizes[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE];
+    for (uint32_t i = 0; i < CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE; i++)
     {
-        // TODO: It is possible to avoid using that flag by updating descriptor sets instead of deleting them.
-        // The application can keep track of recycled descriptor sets and re-use one of them when a new one is requested.
-        // Reference: https://arm-software.github.io/vulkan_best_practice_for_mobile_developers/samples/performance/descriptor_management/descriptor_management_tutorial.html
-        CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)pPool->Device;
-        D->mVkDeviceTable.vkFreeDescriptorSets(D->pVkDevice, pPool->pVkDescPool, numDescriptorSets, pSets);
+        poolSizes[i] = gDescriptorPoolSizes[i];
+        poolSizes[i].descriptorCount = (uint32_t)cgpu_min(cgpu_max(
+            cgpu_max(1ull, (uint64_t)gDescriptorPoolSizes[i].descriptorCount * maxSets / CGPU_VK_DESCRIPTOR_POOL_MAX_SETS),
+            (uint64_t)pSetDescriptorCounts[i] * maxSets), (uint64_t)UINT32_MAX);
+    }
+    VkDescriptorPoolCreateInfo poolCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext = NULL,
+        .flags = 0,
+        .maxSets = maxSets,
+        .poolSizeCount = CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE,
+        .pPoolSizes = poolSizes,
+    };
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    VkResult vk_res = D->mVkDeviceTable.vkCreateDescriptorPool(D->pVkDevice, &poolCreateInfo, &I->vkAllocator, &pool);
+    if (vk_res != VK_SUCCESS)
+    {
+        cgpu_error(&I->super.logger, "Failed to create transient descriptor pool with VkResult: %d\n", (int32_t)vk_res);
+        return VK_NULL_HANDLE;
+    }
+    return pool;
+}
+
+void VkUtil_QueryDescriptorPoolStats(struct VkUtil_DescriptorPool* pPool, CGPUDescriptorPoolStats* pStats)
+{
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pPool->pMutex);
+#endif
+    VkUtil_DrainPendingDescriptorSetFrees(pPool);
+    pStats->pool_count += pPool->mBlockCount;
+    for (uint32_t i = 0; i < pPool->mBlockCount; i++)
+    {
+        pStats->max_sets += pPool->pBlocks[i].mMaxSets;
+        pStats->allocated_sets += pPool->pBlocks[i].mAllocatedSets;
     }
 #ifdef CGPU_THREAD_SAFETY
     skr_mutex_release(pPool->pMutex);
@@ -639,7 +951,19 @@ void VkUtil_FreeDescriptorPool(struct VkUtil_DescriptorPool* DescPool)
     CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
     CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
     const CGPUAllocator* allocator = &I->super.allocator;
-    D->mVkDeviceTable.vkDestroyDescriptorPool(D->pVkDevice, DescPool->pVkDescPool, &I->vkAllocator);
+    for (uint32_t i = 0; i < DescPool->mBlockCount; i++)
+    {
+        D->mVkDeviceTable.vkDestroyDescriptorPool(D->pVkDevice, DescPool->pBlocks[i].pVkDescPool, &I->vkAllocator);
+    }
+    // Destroying the blocks releases the pending sets as well
+    VkUtil_PendingDescriptorSetFree* Pending = (VkUtil_PendingDescriptorSetFree*)skr_atomicuptr_store_relaxed(&DescPool->mPendingFrees, 0);
+    while (Pending)
+    {
+        VkUtil_PendingDescriptorSetFree* Next = Pending->pNext;
+        cgpu_free(allocator, Pending);
+        Pending = Next;
+    }
+    cgpu_free(allocator, DescPool->pBlocks);
 #ifdef CGPU_THREAD_SAFETY
     if (DescPool->pMutex)
     {
@@ -650,6 +974,725 @@ void VkUtil_FreeDescriptorPool(struct VkUtil_DescriptorPool* DescPool)
     cgpu_free(allocator, DescPool);
 }
 
+// Descriptor Buffer
+struct VkUtil_DescriptorBuffer* VkUtil_CreateDescriptorBuffer(CGPUDevice_Vulkan* D)
+{
+#if VK_EXT_descriptor_buffer && VK_KHR_buffer_device_address
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT* Props = &A->mPhysicalDeviceDescriptorBufferProperties;
+    PFN_vkGetBufferDeviceAddress pfnGetBufferDeviceAddress = D->mVkDeviceTable.vkGetBufferDeviceAddress ?
+        D->mVkDeviceTable.vkGetBufferDeviceAddress : D->mVkDeviceTable.vkGetBufferDeviceAddressKHR;
+    const bool supported = A->descriptor_buffer && A->buffer_device_address &&
+        A->mPhysicalDeviceDescriptorBufferFeatures.descriptorBuffer &&
+        A->mPhysicalDeviceBufferDeviceAddressFeatures.bufferDeviceAddress &&
+        D->mVkDeviceTable.vkGetDescriptorEXT && D->mVkDeviceTable.vkGetDescriptorSetLayoutSizeEXT &&
+        D->mVkDeviceTable.vkGetDescriptorSetLayoutBindingOffsetEXT &&
+        D->mVkDeviceTable.vkCmdBindDescriptorBuffersEXT && D->mVkDeviceTable.vkCmdSetDescriptorBufferOffsetsEXT &&
+        pfnGetBufferDeviceAddress;
+    if (!supported) return CGPU_NULLPTR;
+    // One binding serves both sampler and resource descriptors, so it must fit both address spaces
+    VkDeviceSize size = CGPU_VK_DESCRIPTOR_BUFFER_SIZE;
+    size = cgpu_min(size, Props->samplerDescriptorBufferAddressSpaceSize);
+    size = cgpu_min(size, Props->resourceDescriptorBufferAddressSpaceSize);
+    size = cgpu_min(size, Props->descriptorBufferAddressSpaceSize);
+    size = cgpu_min(size, Props->maxSamplerDescriptorBufferRange);
+    size = cgpu_min(size, Props->maxResourceDescriptorBufferRange);
+    VkBufferCreateInfo bufferInfo = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = NULL,
+        .flags = 0,
+        .size = size,
+        .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                 VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = NULL
+    };
+    // Descriptors are written straight into mapped memory, coherent so no flushes are needed
+    VmaAllocationCreateInfo allocInfo = {
+        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
+        .usage = VMA_MEMORY_USAGE_AUTO,
+        .requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+    };
+    CGPU_DECLARE_ZERO(VmaAllocationInfo, allocResult)
+    VkBuffer pVkBuffer = VK_NULL_HANDLE;
+    VmaAllocation pVmaAllocation = VK_NULL_HANDLE;
+    if (vmaCreateBuffer(D->pVmaAllocator, &bufferInfo, &allocInfo, &pVkBuffer, &pVmaAllocation, &allocResult) != VK_SUCCESS)
+    {
+        cgpu_warn(&I->super.logger, "Failed to create descriptor buffer, falling back to descriptor sets!\n");
+        return CGPU_NULLPTR;
+    }
+    VmaVirtualBlockCreateInfo blockInfo = {
+        .size = size,
+        .flags = 0,
+        .pAllocationCallbacks = &I->vkAllocator
+    };
+    VmaVirtualBlock pVirtualBlock = VK_NULL_HANDLE;
+    if (vmaCreateVirtualBlock(&blockInfo, &pVirtualBlock) != VK_SUCCESS)
+    {
+        vmaDestroyBuffer(D->pVmaAllocator, pVkBuffer, pVmaAllocation);
+        return CGPU_NULLPTR;
+    }
+    VkUtil_DescriptorBuffer* Buffer = (VkUtil_DescriptorBuffer*)cgpu_calloc(allocator, 1, sizeof(VkUtil_DescriptorBuffer));
+    Buffer->Device = D;
+    Buffer->pVkBuffer = pVkBuffer;
+    Buffer->pVmaAllocation = pVmaAllocation;
+    Buffer->pVirtualBlock = pVirtualBlock;
+    Buffer->pMappedData = (uint8_t*)allocResult.pMappedData;
+    Buffer->mSize = size;
+    Buffer->mOffsetAlignment = cgpu_max((VkDeviceSize)1, Props->descriptorBufferOffsetAlignment);
+    VkBufferDeviceAddressInfo addressInfo = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext = NULL,
+        .buffer = pVkBuffer
+    };
+    Buffer->mAddress = pfnGetBufferDeviceAddress(D->pVkDevice, &addressInfo);
+#ifdef CGPU_THREAD_SAFETY
+    Buffer->pMutex = (SMutex*)cgpu_calloc(allocator, 1, sizeof(SMutex));
+    skr_init_mutex(Buffer->pMutex);
+#endif
+    return Buffer;
+#else
+    return CGPU_NULLPTR;
+#endif
+}
+
+bool VkUtil_DescriptorBufferAllocate(struct VkUtil_DescriptorBuffer* pBuffer, VkDeviceSize size, uint64_t* pAllocation, VkDeviceSize* pOffset)
+{
+    VmaVirtualAllocationCreateInfo allocInfo = {
+        .size = cgpu_max((VkDeviceSize)1, size),
+        .alignment = pBuffer->mOffsetAlignment,
+        .flags = 0,
+        .pUserData = NULL
+    };
+    VmaVirtualAllocation allocation = VK_NULL_HANDLE;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pBuffer->pMutex);
+#endif
+    const VkResult result = vmaVirtualAllocate(pBuffer->pVirtualBlock, &allocInfo, &allocation, pOffset);
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pBuffer->pMutex);
+#endif
+    if (result != VK_SUCCESS)
+    {
+        cgpu_error(&pBuffer->Device->super.adapter->instance->logger, "Descriptor buffer is full!\n");
+        return false;
+    }
+    *pAllocation = (uint64_t)allocation;
+    return true;
+}
+
+void VkUtil_DescriptorBufferFree(struct VkUtil_DescriptorBuffer* pBuffer, uint64_t allocation)
+{
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pBuffer->pMutex);
+#endif
+    vmaVirtualFree(pBuffer->pVirtualBlock, (VmaVirtualAllocation)allocation);
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pBuffer->pMutex);
+#endif
+}
+
+void VkUtil_FreeDescriptorBuffer(struct VkUtil_DescriptorBuffer* pBuffer)
+{
+    CGPUDevice_Vulkan* D = pBuffer->Device;
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+    // Sets still alive are released with the block
+    vmaClearVirtualBlock(pBuffer->pVirtualBlock);
+    vmaDestroyVirtualBlock(pBuffer->pVirtualBlock);
+    vmaDestroyBuffer(D->pVmaAllocator, pBuffer->pVkBuffer, pBuffer->pVmaAllocation);
+#ifdef CGPU_THREAD_SAFETY
+    if (pBuffer->pMutex)
+    {
+        skr_destroy_mutex(pBuffer->pMutex);
+        cgpu_free(allocator, pBuffer->pMutex);
+    }
+#endif
+    cgpu_free(allocator, pBuffer);
+}
+
+void VkUtil_RecordDescriptorBufferLayout(CGPUDevice_Vulkan* D, SetLayout_Vulkan* SetLayout, const CGPUParameterTable* pTable)
+{
+#if VK_EXT_descriptor_buffer
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+    D->mVkDeviceTable.vkGetDescriptorSetLayoutSizeEXT(D->pVkDevice, SetLayout->layout, &SetLayout->mDescriptorBufferSize);
+    if (pTable && pTable->resources_count)
+    {
+        SetLayout->pDescriptorBufferOffsets = (VkDeviceSize*)cgpu_calloc(allocator, pTable->resources_count, sizeof(VkDeviceSize));
+        for (uint32_t i = 0; i < pTable->resources_count; i++)
+        {
+            D->mVkDeviceTable.vkGetDescriptorSetLayoutBindingOffsetEXT(D->pVkDevice, SetLayout->layout,
+                pTable->p_resources[i].binding, &SetLayout->pDescriptorBufferOffsets[i]);
+        }
+    }
+#endif
+}
+
+#if VK_EXT_descriptor_buffer
+// Array elements of a binding are tightly packed at the descriptor size of its type
+static size_t VkUtil_DescriptorBufferDescriptorSize(const CGPUAdapter_Vulkan* A, VkDescriptorType type)
+{
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT* Props = &A->mPhysicalDeviceDescriptorBufferProperties;
+    const bool robust = A->mPhysicalDeviceFeatures.features.robustBufferAccess;
+    switch (type)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLER: return Props->samplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: return Props->combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE: return Props->sampledImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE: return Props->storageImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        return robust ? Props->robustUniformTexelBufferDescriptorSize : Props->uniformTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return robust ? Props->robustStorageTexelBufferDescriptorSize : Props->storageTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return robust ? Props->robustUniformBufferDescriptorSize : Props->uniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return robust ? Props->robustStorageBufferDescriptorSize : Props->storageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return Props->inputAttachmentDescriptorSize;
+    default: return 0;
+    }
+}
+#endif
+
+void VkUtil_UpdateDescriptorBufferSet(CGPUDescriptorSet_Vulkan* Set, const CGPUParameterTable* pTable, uint32_t tableIndex,
+    uint32_t count, const struct CGPUDescriptorData* datas)
+{
+#if VK_EXT_descriptor_buffer
+    const CGPURootSignature_Vulkan* RS = (const CGPURootSignature_Vulkan*)Set->super.root_signature;
+    CGPUDevice_Vulkan* D = (CGPUDevice_Vulkan*)RS->super.device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    const SetLayout_Vulkan* SetLayout = &RS->pSetLayouts[Set->super.index];
+    uint8_t* pSetData = D->pDescriptorBuffer->pMappedData + Set->mDescriptorBufferOffset;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const CGPUDescriptorData* pParam = datas + i;
+        const CGPUShaderResource* ResData = CGPUUtil_FindDescriptorResource(pTable, tableIndex, pParam);
+        if (ResData == CGPU_NULLPTR)
+        {
+            cgpu_assert(0 && "Descriptor binding not found in set!");
+            continue;
+        }
+        const uint32_t arrayCount = cgpu_max(1U, pParam->count);
+        const ECGPUResourceTypeFlags resourceType = (ECGPUResourceTypeFlags)ResData->type;
+        // Root signatures with dynamic buffers stay on descriptor sets, so no dynamic types here
+        const VkDescriptorType descriptorType = VkUtil_TranslateResourceType(resourceType);
+        const size_t descriptorSize = VkUtil_DescriptorBufferDescriptorSize(A, descriptorType);
+        uint8_t* pDst = pSetData + SetLayout->pDescriptorBufferOffsets[ResData - pTable->p_resources];
+        for (uint32_t arr = 0; arr < arrayCount; ++arr, pDst += descriptorSize)
+        {
+            VkDescriptorGetInfoEXT getInfo = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = NULL,
+                .type = descriptorType
+            };
+            VkDescriptorImageInfo imageInfo = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED };
+            VkDescriptorAddressInfoEXT addressInfo = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                .pNext = NULL,
+                .address = 0,
+                .range = 0,
+                .format = VK_FORMAT_UNDEFINED
+            };
+            switch (resourceType)
+            {
+            case CGPU_RESOURCE_TYPE_RW_TEXTURE:
+            case CGPU_RESOURCE_TYPE_TEXTURE: {
+                const CGPUTextureView_Vulkan* TextureView = (const CGPUTextureView_Vulkan*)pParam->resources.textures[arr];
+                cgpu_assert(TextureView && "cgpu_assert: Binding NULL texture!");
+                imageInfo.imageView = resourceType == CGPU_RESOURCE_TYPE_RW_TEXTURE ? TextureView->pVkUAVDescriptor : TextureView->pVkSRVDescriptor;
+                imageInfo.imageLayout = resourceType == CGPU_RESOURCE_TYPE_RW_TEXTURE ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                if (resourceType == CGPU_RESOURCE_TYPE_RW_TEXTURE)
+                    getInfo.data.pStorageImage = &imageInfo;
+                else
+                    getInfo.data.pSampledImage = &imageInfo;
+                break;
+            }
+            case CGPU_RESOURCE_TYPE_SAMPLER: {
+                const CGPUSampler_Vulkan* Sampler = (const CGPUSampler_Vulkan*)pParam->resources.samplers[arr];
+                cgpu_assert(Sampler && "cgpu_assert: Binding NULL Sampler!");
+                getInfo.data.pSampler = &Sampler->pVkSampler;
+                break;
+            }
+            case CGPU_RESOURCE_TYPE_UNIFORM_BUFFER:
+            case CGPU_RESOURCE_TYPE_BUFFER:
+            case CGPU_RESOURCE_TYPE_BUFFER_RAW:
+            case CGPU_RESOURCE_TYPE_RW_BUFFER:
+            case CGPU_RESOURCE_TYPE_RW_BUFFER_RAW: {
+                const CGPUBuffer_Vulkan* Buffer = (const CGPUBuffer_Vulkan*)pParam->resources.buffers[arr];
+                cgpu_assert(Buffer && "cgpu_assert: Binding NULL Buffer!");
+                cgpu_assert(Buffer->mDeviceAddress && "cgpu_assert: Buffer has no device address!");
+                VkDeviceSize offset = Buffer->mOffset;
+                VkDeviceSize range = Buffer->super.info->size - Buffer->mOffset;
+                if (pParam->params.buffers_params.offsets)
+                {
+                    offset = pParam->params.buffers_params.offsets[arr];
+                    range = pParam->params.buffers_params.sizes[arr];
+                }
+                addressInfo.address = Buffer->mDeviceAddress + offset;
+                addressInfo.range = range;
+                if (descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+                    getInfo.data.pUniformBuffer = &addressInfo;
+                else
+                    getInfo.data.pStorageBuffer = &addressInfo;
+                break;
+            }
+            default:
+                cgpu_assert(0 && resourceType && "Descriptor Type not supported!");
+                continue;
+            }
+            D->mVkDeviceTable.vkGetDescriptorEXT(D->pVkDevice, &getInfo, descriptorSize, pDst);
+        }
+    }
+#endif
+}
+
+void VkUtil_CmdBindDescriptorBufferSet(CGPUCommandBuffer_Vulkan* Cmd, const CGPUDescriptorSet_Vulkan* Set, VkPipelineBindPoint bindPoint)
+{
+#if VK_EXT_descriptor_buffer
+    const CGPURootSignature_Vulkan* RS = (const CGPURootSignature_Vulkan*)Set->super.root_signature;
+    const CGPUDevice_Vulkan* D = (const CGPUDevice_Vulkan*)RS->super.device;
+    if (!Cmd->mDescriptorBufferBound)
+    {
+        VkDescriptorBufferBindingInfoEXT bindingInfo = {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+            .pNext = NULL,
+            .address = D->pDescriptorBuffer->mAddress,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT
+        };
+        D->mVkDeviceTable.vkCmdBindDescriptorBuffersEXT(Cmd->pVkCmdBuf, 1, &bindingInfo);
+        Cmd->mDescriptorBufferBound = true;
+    }
+    const uint32_t bufferIndex = 0;
+    D->mVkDeviceTable.vkCmdSetDescriptorBufferOffsetsEXT(Cmd->pVkCmdBuf, bindPoint, RS->pPipelineLayout,
+        Set->super.index, 1, &bufferIndex, &Set->mDescriptorBufferOffset);
+#endif
+}
+
+// Bindless Heap
+static uint32_t VkUtil_ClampBindlessCapacity(CGPUAdapter_Vulkan* A, uint32_t bindlessClass, uint32_t requested)
+{
+    uint32_t capacity = requested;
+#if VK_EXT_descriptor_indexing
+    const VkPhysicalDeviceDescriptorIndexingPropertiesEXT* Props = &A->mPhysicalDeviceDescriptorIndexingProperties;
+    if (bindlessClass == CGPU_VK_BINDLESS_TEXTURES)
+    {
+        capacity = cgpu_min(capacity, Props->maxDescriptorSetUpdateAfterBindSampledImages);
+        capacity = cgpu_min(capacity, Props->maxPerStageDescriptorUpdateAfterBindSampledImages);
+    }
+    else
+    {
+        capacity = cgpu_min(capacity, Props->maxDescriptorSetUpdateAfterBindStorageBuffers);
+        capacity = cgpu_min(capacity, Props->maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    }
+#endif
+    return capacity;
+}
+
+static bool VkUtil_CreateBindlessTable(VkUtil_BindlessHeap* pHeap, uint32_t bindlessClass)
+{
+    CGPUDevice_Vulkan* D = pHeap->Device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    VkUtil_BindlessTable* Table = &pHeap->mTables[bindlessClass];
+    const VkDescriptorBindingFlagsEXT bindingFlags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT flagsInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+        .pNext = NULL,
+        .bindingCount = 1,
+        .pBindingFlags = &bindingFlags
+    };
+    VkDescriptorSetLayoutBinding binding = {
+        .binding = 0,
+        .descriptorType = Table->mType,
+        .descriptorCount = Table->mCapacity,
+        .stageFlags = VK_SHADER_STAGE_ALL,
+        .pImmutableSamplers = NULL
+    };
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .pNext = &flagsInfo,
+        .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+        .bindingCount = 1,
+        .pBindings = &binding
+    };
+    if (D->mVkDeviceTable.vkCreateDescriptorSetLayout(D->pVkDevice, &layoutInfo, &I->vkAllocator, &Table->pLayout) != VK_SUCCESS)
+    {
+        cgpu_error(&I->super.logger, "Failed to create bindless descriptor set layout!\n");
+        return false;
+    }
+    VkDescriptorSetAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .pNext = NULL,
+        .descriptorPool = pHeap->pVkDescPool,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &Table->pLayout
+    };
+    if (D->mVkDeviceTable.vkAllocateDescriptorSets(D->pVkDevice, &allocInfo, &Table->pSet) != VK_SUCCESS)
+    {
+        cgpu_error(&I->super.logger, "Failed to allocate bindless descriptor set!\n");
+        return false;
+    }
+    Table->pFreeIndices = (uint32_t*)cgpu_calloc(allocator, Table->mCapacity, sizeof(uint32_t));
+    return true;
+}
+
+struct VkUtil_BindlessHeap* VkUtil_CreateBindlessHeap(CGPUDevice_Vulkan* D, uint32_t textureCount, uint32_t bufferCount)
+{
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+#if VK_EXT_descriptor_indexing
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT* Features = &A->mPhysicalDeviceDescriptorIndexingFeatures;
+    const bool supported = A->descriptor_indexing && Features->runtimeDescriptorArray && Features->descriptorBindingPartiallyBound;
+    if (!supported || !Features->descriptorBindingSampledImageUpdateAfterBind)
+        textureCount = 0;
+    if (!supported || !Features->descriptorBindingStorageBufferUpdateAfterBind)
+        bufferCount = 0;
+#else
+    textureCount = 0;
+    bufferCount = 0;
+#endif
+    textureCount = VkUtil_ClampBindlessCapacity(A, CGPU_VK_BINDLESS_TEXTURES, textureCount);
+    bufferCount = VkUtil_ClampBindlessCapacity(A, CGPU_VK_BINDLESS_BUFFERS, bufferCount);
+    if (textureCount == 0 && bufferCount == 0)
+    {
+        cgpu_warn(&I->super.logger, "Bindless heap requested but descriptor indexing with update-after-bind is not supported!\n");
+        return CGPU_NULLPTR;
+    }
+    VkUtil_BindlessHeap* Heap = (VkUtil_BindlessHeap*)cgpu_calloc(allocator, 1, sizeof(VkUtil_BindlessHeap));
+    Heap->Device = D;
+#ifdef CGPU_THREAD_SAFETY
+    Heap->pMutex = (SMutex*)cgpu_calloc(allocator, 1, sizeof(SMutex));
+    skr_init_mutex(Heap->pMutex);
+#endif
+    Heap->mTables[CGPU_VK_BINDLESS_TEXTURES].mType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    Heap->mTables[CGPU_VK_BINDLESS_TEXTURES].mCapacity = textureCount;
+    Heap->mTables[CGPU_VK_BINDLESS_BUFFERS].mType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    Heap->mTables[CGPU_VK_BINDLESS_BUFFERS].mCapacity = bufferCount;
+    // One pool backs both sets, it is never reset or freed from
+    VkDescriptorPoolSize poolSizes[CGPU_VK_BINDLESS_CLASS_COUNT];
+    uint32_t poolSizeCount = 0;
+    for (uint32_t i = 0; i < CGPU_VK_BINDLESS_CLASS_COUNT; i++)
+    {
+        if (Heap->mTables[i].mCapacity == 0) continue;
+        poolSizes[poolSizeCount].type = Heap->mTables[i].mType;
+        poolSizes[poolSizeCount].descriptorCount = Heap->mTables[i].mCapacity;
+        poolSizeCount++;
+    }
+    VkDescriptorPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext = NULL,
+        .flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT,
+        .maxSets = poolSizeCount,
+        .poolSizeCount = poolSizeCount,
+        .pPoolSizes = poolSizes
+    };
+    bool succeed = D->mVkDeviceTable.vkCreateDescriptorPool(D->pVkDevice, &poolInfo, &I->vkAllocator, &Heap->pVkDescPool) == VK_SUCCESS;
+    for (uint32_t i = 0; succeed && i < CGPU_VK_BINDLESS_CLASS_COUNT; i++)
+    {
+        if (Heap->mTables[i].mCapacity == 0) continue;
+        succeed = VkUtil_CreateBindlessTable(Heap, i);
+    }
+    if (!succeed)
+    {
+        cgpu_error(&I->super.logger, "Failed to create bindless heap!\n");
+        VkUtil_FreeBindlessHeap(Heap);
+        return CGPU_NULLPTR;
+    }
+    return Heap;
+}
+
+// Moves pending indices whose frame has completed back to the free list
+static void VkUtil_RecycleBindlessIndices(VkUtil_BindlessHeap* pHeap, VkUtil_BindlessTable* Table)
+{
+    uint32_t recycled = 0;
+    while (recycled < Table->mPendingCount && Table->pPendingFrees[recycled].mFrame < pHeap->mCompletedFrames)
+    {
+        Table->pFreeIndices[Table->mFreeCount++] = Table->pPendingFrees[recycled].mIndex;
+        recycled++;
+    }
+    if (recycled)
+    {
+        Table->mPendingCount -= recycled;
+        memmove(Table->pPendingFrees, Table->pPendingFrees + recycled, Table->mPendingCount * sizeof(VkUtil_BindlessPendingFree));
+    }
+}
+
+uint32_t VkUtil_BindlessAllocateIndex(struct VkUtil_BindlessHeap* pHeap, uint32_t bindlessClass)
+{
+    VkUtil_BindlessTable* Table = &pHeap->mTables[bindlessClass];
+    uint32_t index = CGPU_INVALID_BINDLESS_INDEX;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pHeap->pMutex);
+#endif
+    if (Table->mFreeCount)
+    {
+        index = Table->pFreeIndices[--Table->mFreeCount];
+    }
+    else if (Table->mNextIndex < Table->mCapacity)
+    {
+        index = Table->mNextIndex++;
+    }
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pHeap->pMutex);
+#endif
+    return index;
+}
+
+void VkUtil_BindlessReleaseIndex(struct VkUtil_BindlessHeap* pHeap, uint32_t bindlessClass, uint32_t index)
+{
+    CGPUDevice_Vulkan* D = pHeap->Device;
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+    VkUtil_BindlessTable* Table = &pHeap->mTables[bindlessClass];
+    cgpu_assert(index < Table->mNextIndex && "Bindless index out of range!");
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pHeap->pMutex);
+#endif
+    if (Table->mPendingCount == Table->mPendingCapacity)
+    {
+        Table->mPendingCapacity = cgpu_max(16u, Table->mPendingCapacity * 2);
+        Table->pPendingFrees = (VkUtil_BindlessPendingFree*)cgpu_realloc(allocator,
+            Table->pPendingFrees, Table->mPendingCapacity * sizeof(VkUtil_BindlessPendingFree));
+    }
+    Table->pPendingFrees[Table->mPendingCount].mFrame = pHeap->mFrameIndex;
+    Table->pPendingFrees[Table->mPendingCount].mIndex = index;
+    Table->mPendingCount++;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pHeap->pMutex);
+#endif
+}
+
+void VkUtil_AdvanceBindlessFrame(struct VkUtil_BindlessHeap* pHeap, CGPUFenceId fence)
+{
+    CGPUDevice_Vulkan* D = pHeap->Device;
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pHeap->pMutex);
+#endif
+    if (pHeap->mInFlightCount == pHeap->mInFlightCapacity)
+    {
+        pHeap->mInFlightCapacity = cgpu_max(4u, pHeap->mInFlightCapacity * 2);
+        pHeap->pInFlightFrames = (VkUtil_BindlessFrame*)cgpu_realloc(allocator,
+            pHeap->pInFlightFrames, pHeap->mInFlightCapacity * sizeof(VkUtil_BindlessFrame));
+    }
+    pHeap->pInFlightFrames[pHeap->mInFlightCount].mFrame = pHeap->mFrameIndex++;
+    pHeap->pInFlightFrames[pHeap->mInFlightCount].pFence = fence;
+    pHeap->mInFlightCount++;
+    // A frame without a fence is considered complete as soon as it is advanced past
+    uint32_t completed = 0;
+    while (completed < pHeap->mInFlightCount)
+    {
+        const VkUtil_BindlessFrame* Oldest = &pHeap->pInFlightFrames[completed];
+        if (Oldest->pFence && cgpu_query_fence_status_vulkan(Oldest->pFence) == CGPU_FENCE_STATUS_INCOMPLETE)
+            break;
+        pHeap->mCompletedFrames = Oldest->mFrame + 1;
+        completed++;
+    }
+    if (completed)
+    {
+        pHeap->mInFlightCount -= completed;
+        memmove(pHeap->pInFlightFrames, pHeap->pInFlightFrames + completed, pHeap->mInFlightCount * sizeof(VkUtil_BindlessFrame));
+    }
+    for (uint32_t i = 0; i < CGPU_VK_BINDLESS_CLASS_COUNT; i++)
+    {
+        VkUtil_RecycleBindlessIndices(pHeap, &pHeap->mTables[i]);
+    }
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pHeap->pMutex);
+#endif
+}
+
+void VkUtil_FreeBindlessHeap(struct VkUtil_BindlessHeap* pHeap)
+{
+    CGPUDevice_Vulkan* D = pHeap->Device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    for (uint32_t i = 0; i < CGPU_VK_BINDLESS_CLASS_COUNT; i++)
+    {
+        VkUtil_BindlessTable* Table = &pHeap->mTables[i];
+        if (Table->pLayout != VK_NULL_HANDLE)
+            D->mVkDeviceTable.vkDestroyDescriptorSetLayout(D->pVkDevice, Table->pLayout, &I->vkAllocator);
+        cgpu_free(allocator, Table->pFreeIndices);
+        cgpu_free(allocator, Table->pPendingFrees);
+    }
+    // Destroying the pool releases the sets as well
+    if (pHeap->pVkDescPool != VK_NULL_HANDLE)
+        D->mVkDeviceTable.vkDestroyDescriptorPool(D->pVkDevice, pHeap->pVkDescPool, &I->vkAllocator);
+    cgpu_free(allocator, pHeap->pInFlightFrames);
+#ifdef CGPU_THREAD_SAFETY
+    if (pHeap->pMutex)
+    {
+        skr_destroy_mutex(pHeap->pMutex);
+        cgpu_free(allocator, pHeap->pMutex);
+    }
+#endif
+    cgpu_free(allocator, pHeap);
+}
+
+// Emulated Timeline Semaphores
+struct VkUtil_EmulatedTimeline* VkUtil_CreateEmulatedTimeline(CGPUDevice_Vulkan* D, uint64_t initialValue)
+{
+    const CGPUAllocator* allocator = &D->super.adapter->instance->allocator;
+    VkUtil_EmulatedTimeline* Timeline = (VkUtil_EmulatedTimeline*)cgpu_calloc(allocator, 1, sizeof(VkUtil_EmulatedTimeline));
+    Timeline->Device = D;
+    Timeline->mCompletedValue = initialValue;
+#ifdef CGPU_THREAD_SAFETY
+    Timeline->pMutex = (SMutex*)cgpu_calloc(allocator, 1, sizeof(SMutex));
+    skr_init_mutex(Timeline->pMutex);
+#endif
+    return Timeline;
+}
+
+// Retires every signaled point, fences may finish out of order when several queues signal
+static void VkUtil_RetireTimelinePoints(VkUtil_EmulatedTimeline* pTimeline)
+{
+    CGPUDevice_Vulkan* D = pTimeline->Device;
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < pTimeline->mPendingCount; i++)
+    {
+        const VkUtil_TimelinePoint Point = pTimeline->pPendingPoints[i];
+        if (D->mVkDeviceTable.vkGetFenceStatus(D->pVkDevice, Point.pVkFence) == VK_SUCCESS)
+        {
+            D->mVkDeviceTable.vkResetFences(D->pVkDevice, 1, &Point.pVkFence);
+            pTimeline->pFreeFences[pTimeline->mFreeCount++] = Point.pVkFence;
+            pTimeline->mCompletedValue = cgpu_max(pTimeline->mCompletedValue, Point.mValue);
+        }
+        else
+        {
+            pTimeline->pPendingPoints[kept++] = Point;
+        }
+    }
+    pTimeline->mPendingCount = kept;
+}
+
+VkFence VkUtil_EmulatedTimelineAddPoint(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value)
+{
+    CGPUDevice_Vulkan* D = pTimeline->Device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    VkFence Fence = VK_NULL_HANDLE;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pTimeline->pMutex);
+#endif
+    // Timelines nobody waits on or queries would otherwise only ever grow
+    if (pTimeline->mPendingCount == pTimeline->mPendingCapacity)
+        VkUtil_RetireTimelinePoints(pTimeline);
+    if (pTimeline->mPendingCount == pTimeline->mPendingCapacity)
+    {
+        // The free list can hold every fence ever created, so both grow together
+        pTimeline->mPendingCapacity = cgpu_max(4u, pTimeline->mPendingCapacity * 2);
+        pTimeline->pPendingPoints = (VkUtil_TimelinePoint*)cgpu_realloc(allocator,
+            pTimeline->pPendingPoints, pTimeline->mPendingCapacity * sizeof(VkUtil_TimelinePoint));
+        pTimeline->mFreeCapacity = pTimeline->mPendingCapacity;
+        pTimeline->pFreeFences = (VkFence*)cgpu_realloc(allocator,
+            pTimeline->pFreeFences, pTimeline->mFreeCapacity * sizeof(VkFence));
+    }
+    if (pTimeline->mFreeCount)
+    {
+        Fence = pTimeline->pFreeFences[--pTimeline->mFreeCount];
+    }
+    else
+    {
+        VkFenceCreateInfo fence_info = {
+            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+            .pNext = NULL,
+            .flags = 0,
+        };
+        CHECK_VKRESULT(&I->super.logger, D->mVkDeviceTable.vkCreateFence(D->pVkDevice, &fence_info, &I->vkAllocator, &Fence));
+    }
+    if (Fence != VK_NULL_HANDLE)
+    {
+        pTimeline->pPendingPoints[pTimeline->mPendingCount].mValue = value;
+        pTimeline->pPendingPoints[pTimeline->mPendingCount].pVkFence = Fence;
+        pTimeline->mPendingCount++;
+    }
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pTimeline->pMutex);
+#endif
+    return Fence;
+}
+
+// Only values already covered by a submitted signal can be waited on, false is returned immediately otherwise
+bool VkUtil_EmulatedTimelineWait(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value, uint64_t timeoutNs)
+{
+    CGPUDevice_Vulkan* D = pTimeline->Device;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pTimeline->pMutex);
+#endif
+    VkUtil_RetireTimelinePoints(pTimeline);
+    const VkUtil_TimelinePoint* Target = CGPU_NULLPTR;
+    for (uint32_t i = 0; pTimeline->mCompletedValue < value && i < pTimeline->mPendingCount; i++)
+    {
+        const VkUtil_TimelinePoint* Point = &pTimeline->pPendingPoints[i];
+        if (Point->mValue >= value && (!Target || Point->mValue < Target->mValue))
+            Target = Point;
+    }
+    if (Target && D->mVkDeviceTable.vkWaitForFences(D->pVkDevice, 1, &Target->pVkFence, VK_TRUE, timeoutNs) == VK_SUCCESS)
+        VkUtil_RetireTimelinePoints(pTimeline);
+    const bool reached = pTimeline->mCompletedValue >= value;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pTimeline->pMutex);
+#endif
+    return reached;
+}
+
+void VkUtil_EmulatedTimelineSignal(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value)
+{
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pTimeline->pMutex);
+#endif
+    pTimeline->mCompletedValue = cgpu_max(pTimeline->mCompletedValue, value);
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pTimeline->pMutex);
+#endif
+}
+
+uint64_t VkUtil_EmulatedTimelineQuery(struct VkUtil_EmulatedTimeline* pTimeline)
+{
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_acquire(pTimeline->pMutex);
+#endif
+    VkUtil_RetireTimelinePoints(pTimeline);
+    const uint64_t value = pTimeline->mCompletedValue;
+#ifdef CGPU_THREAD_SAFETY
+    skr_mutex_release(pTimeline->pMutex);
+#endif
+    return value;
+}
+
+void VkUtil_FreeEmulatedTimeline(struct VkUtil_EmulatedTimeline* pTimeline)
+{
+    CGPUDevice_Vulkan* D = pTimeline->Device;
+    CGPUAdapter_Vulkan* A = (CGPUAdapter_Vulkan*)D->super.adapter;
+    CGPUInstance_Vulkan* I = (CGPUInstance_Vulkan*)A->super.instance;
+    const CGPUAllocator* allocator = &I->super.allocator;
+    for (uint32_t i = 0; i < pTimeline->mPendingCount; i++)
+    {
+        VkFence Fence = pTimeline->pPendingPoints[i].pVkFence;
+        D->mVkDeviceTable.vkWaitForFences(D->pVkDevice, 1, &Fence, VK_TRUE, UINT64_MAX);
+        D->mVkDeviceTable.vkDestroyFence(D->pVkDevice, Fence, &I->vkAllocator);
+    }
+    for (uint32_t i = 0; i < pTimeline->mFreeCount; i++)
+    {
+        D->mVkDeviceTable.vkDestroyFence(D->pVkDevice, pTimeline->pFreeFences[i], &I->vkAllocator);
+    }
+    cgpu_free(allocator, pTimeline->pPendingPoints);
+    cgpu_free(allocator, pTimeline->pFreeFences);
+#ifdef CGPU_THREAD_SAFETY
+    if (pTimeline->pMutex)
+    {
+        skr_destroy_mutex(pTimeline->pMutex);
+        cgpu_free(allocator, pTimeline->pMutex);
+    }
+#endif
+    cgpu_free(allocator, pTimeline);
+}
+
 VkDescriptorSetLayout VkUtil_CreateDescriptorSetLayout(CGPUDevice_Vulkan* D,
 const VkDescriptorSetLayoutBinding* bindings, uint32_t bindings_count)
 {
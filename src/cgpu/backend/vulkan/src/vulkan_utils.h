@@ -8,6 +8,7 @@
 #include "cgpu_vulkan.h"
 #include "internal/vk_mem_alloc.h"
 #include "common_utils.h"
+#include "atomic.h"
 
 #include "vulkan/vulkan_core.h"
 
@@ -43,17 +44,58 @@ void VkUtil_QueryAllAdapters(CGPUInstance_Vulkan* I,
     const char* const* device_extensions, uint32_t device_extension_count);
 
 // Device Helpers
-void VkUtil_CreatePipelineCache(CGPUDevice_Vulkan* D);
+void VkUtil_CreatePipelineCache(CGPUDevice_Vulkan* D, const void* pInitialData, size_t initialDataSize);
 void VkUtil_CreateVMAAllocator(CGPUInstance_Vulkan* I, CGPUAdapter_Vulkan* A, CGPUDevice_Vulkan* D);
 void VkUtil_FreeVMAAllocator(CGPUInstance_Vulkan* I, CGPUAdapter_Vulkan* A, CGPUDevice_Vulkan* D);
 void VkUtil_FreePipelineCache(CGPUInstance_Vulkan* I, CGPUAdapter_Vulkan* A, CGPUDevice_Vulkan* D);
 void VkUtil_EnsureFeatures(CGPUAdapter_Vulkan* A, CGPUDevice_Vulkan* D);
 
 // API Objects Helpers
-struct VkUtil_DescriptorPool* VkUtil_CreateDescriptorPool(CGPUDevice_Vulkan* D);
-void VkUtil_ConsumeDescriptorSets(struct VkUtil_DescriptorPool* pPool, const VkDescriptorSetLayout* pLayouts, VkDescriptorSet* pSets, uint32_t numDescriptorSets);
-void VkUtil_ReturnDescriptorSets(struct VkUtil_DescriptorPool* pPool, VkDescriptorSet* pSets, uint32_t numDescriptorSets);
+struct VkUtil_DescriptorPool* VkUtil_CreateDescriptorPool(CGPUDevice_Vulkan* D, uint32_t shardIndex);
+struct VkUtil_DescriptorPool* VkUtil_AcquireDescriptorPoolShard(CGPUDevice_Vulkan* D);
+// pDescriptorCounts: per-type descriptor counts summed over all sets, nullable
+// Sets returned from a thread of another shard are handed to the owner shard lock-free
+// and released on its next allocation.
+VkDescriptorPool VkUtil_ConsumeDescriptorSets(struct VkUtil_DescriptorPool* pPool, const VkDescriptorSetLayout* pLayouts,
+    const uint32_t* pDescriptorCounts, VkDescriptorSet* pSets, uint32_t numDescriptorSets);
+void VkUtil_ReturnDescriptorSets(struct VkUtil_DescriptorPool* pPool, VkDescriptorPool pVkDescPool,
+    const uint32_t* pDescriptorCounts, VkDescriptorSet* pSets, uint32_t numDescriptorSets);
+VkDescriptorPool VkUtil_CreateTransientDescriptorPool(CGPUDevice_Vulkan* D, uint32_t maxSets, const uint32_t* pSetDescriptorCounts);
+// Accumulates into pStats
+void VkUtil_QueryDescriptorPoolStats(struct VkUtil_DescriptorPool* pPool, CGPUDescriptorPoolStats* pStats);
 void VkUtil_FreeDescriptorPool(struct VkUtil_DescriptorPool* DescPool);
+// Bindless heap, returns NULL if descriptor indexing can't back any requested class
+struct VkUtil_BindlessHeap* VkUtil_CreateBindlessHeap(CGPUDevice_Vulkan* D, uint32_t textureCount, uint32_t bufferCount);
+// Returns CGPU_INVALID_BINDLESS_INDEX if the class is disabled or full
+uint32_t VkUtil_BindlessAllocateIndex(struct VkUtil_BindlessHeap* pHeap, uint32_t bindlessClass);
+// The index is recycled once the frame it is released in has completed
+void VkUtil_BindlessReleaseIndex(struct VkUtil_BindlessHeap* pHeap, uint32_t bindlessClass, uint32_t index);
+void VkUtil_AdvanceBindlessFrame(struct VkUtil_BindlessHeap* pHeap, CGPUFenceId fence);
+void VkUtil_FreeBindlessHeap(struct VkUtil_BindlessHeap* pHeap);
+// Emulated Timeline Semaphores
+struct VkUtil_EmulatedTimeline* VkUtil_CreateEmulatedTimeline(CGPUDevice_Vulkan* D, uint64_t initialValue);
+VkFence VkUtil_EmulatedTimelineAddPoint(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value);
+bool VkUtil_EmulatedTimelineWait(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value, uint64_t timeoutNs);
+void VkUtil_EmulatedTimelineSignal(struct VkUtil_EmulatedTimeline* pTimeline, uint64_t value);
+uint64_t VkUtil_EmulatedTimelineQuery(struct VkUtil_EmulatedTimeline* pTimeline);
+void VkUtil_FreeEmulatedTimeline(struct VkUtil_EmulatedTimeline* pTimeline);
+// Descriptor buffer, returns NULL if VK_EXT_descriptor_buffer is not usable on the device
+struct VkUtil_DescriptorBuffer* VkUtil_CreateDescriptorBuffer(CGPUDevice_Vulkan* D);
+bool VkUtil_DescriptorBufferAllocate(struct VkUtil_DescriptorBuffer* pBuffer, VkDeviceSize size, uint64_t* pAllocation, VkDeviceSize* pOffset);
+void VkUtil_DescriptorBufferFree(struct VkUtil_DescriptorBuffer* pBuffer, uint64_t allocation);
+void VkUtil_FreeDescriptorBuffer(struct VkUtil_DescriptorBuffer* pBuffer);
+// Records the set size and per-resource binding offsets of a descriptor buffer layout
+void VkUtil_RecordDescriptorBufferLayout(CGPUDevice_Vulkan* D, SetLayout_Vulkan* SetLayout, const CGPUParameterTable* pTable);
+void VkUtil_UpdateDescriptorBufferSet(CGPUDescriptorSet_Vulkan* Set, const CGPUParameterTable* pTable, uint32_t tableIndex,
+    uint32_t count, const struct CGPUDescriptorData* datas);
+void VkUtil_CmdBindDescriptorBufferSet(CGPUCommandBuffer_Vulkan* Cmd, const CGPUDescriptorSet_Vulkan* Set, VkPipelineBindPoint bindPoint);
+// Emits queued resource barriers, called before every command that may depend on them
+void VkUtil_FlushBarriers(CGPUCommandBuffer_Vulkan* Cmd);
+void VkUtil_FreePendingBarriers(CGPUCommandBuffer_Vulkan* Cmd);
+// Initial resource states are recorded at the owner queue's next submit instead of blocking creation
+void VkUtil_QueueInitialBufferState(CGPUQueue_Vulkan* Q, CGPUBuffer_Vulkan* B, ECGPUResourceStateFlags state);
+void VkUtil_QueueInitialTextureState(CGPUQueue_Vulkan* Q, CGPUTexture_Vulkan* T, ECGPUResourceStateFlags state);
+void VkUtil_CancelInitialState(CGPUQueue_Vulkan* Q, const void* resource, bool* pInitPending);
 VkDescriptorSetLayout VkUtil_CreateDescriptorSetLayout(CGPUDevice_Vulkan* D, const VkDescriptorSetLayoutBinding* bindings, uint32_t bindings_count);
 void VkUtil_FreeDescriptorSetLayout(CGPUDevice_Vulkan* D, VkDescriptorSetLayout layout);
 void VkUtil_InitializeShaderReflection(CGPUDeviceId device, CGPUShaderLibrary_Vulkan* library, const struct CGPUShaderLibraryDescriptor* desc);
@@ -113,7 +155,6 @@ VKAPI_ATTR void* VKAPI_CALL cgpu_vulkan_realloc(
     size_t                                      size,
     size_t                                      alignment,
     VkSystemAllocationScope                     allocationScope);
-#define CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE (VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1)
 CGPU_UNUSED static const VkDescriptorPoolSize gDescriptorPoolSizes[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE] = {
     { VK_DESCRIPTOR_TYPE_SAMPLER, 1024 },
     { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1 },
@@ -127,14 +168,126 @@ CGPU_UNUSED static const VkDescriptorPoolSize gDescriptorPoolSizes[CGPU_VK_DESCR
     { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 8192 },
     { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1 },
 };
+#define CGPU_VK_DESCRIPTOR_POOL_MAX_SETS 8192
+typedef struct VkUtil_DescriptorPoolBlock {
+    VkDescriptorPool pVkDescPool;
+    uint32_t mMaxSets;
+    uint32_t mAllocatedSets;
+} VkUtil_DescriptorPoolBlock;
+
 typedef struct VkUtil_DescriptorPool {
     CGPUDevice_Vulkan* Device;
-    VkDescriptorPool pVkDescPool;
+    /// Pool chain, a new block is appended when all existing blocks are exhausted
+    VkUtil_DescriptorPoolBlock* pBlocks;
+    uint32_t mBlockCount;
+    uint32_t mBlockCapacity;
+    /// Block that served the last allocation, tried first
+    uint32_t mCurrentBlock;
     VkDescriptorPoolCreateFlags mFlags;
+    /// Live descriptors per type, used to size new blocks
+    uint64_t mDescriptorUsage[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE];
+    uint64_t mAllocatedSets;
+    uint32_t mShardIndex;
+    /// Lock-free stack of VkUtil_PendingDescriptorSetFree returned by other threads
+    SAtomicUPtr mPendingFrees;
     /// Lock for multi-threaded descriptor allocations
     struct SMutex* pMutex;
 } VkUtil_DescriptorPool;
 
+typedef struct VkUtil_PendingDescriptorSetFree {
+    struct VkUtil_PendingDescriptorSetFree* pNext;
+    VkDescriptorPool pVkDescPool;
+    uint32_t mDescriptorCounts[CGPU_VK_DESCRIPTOR_TYPE_RANGE_SIZE];
+    uint32_t mSetCount;
+    VkDescriptorSet* pSets;
+} VkUtil_PendingDescriptorSetFree;
+
+typedef struct VkUtil_DescriptorBuffer {
+    CGPUDevice_Vulkan* Device;
+    VkBuffer pVkBuffer;
+    struct VmaAllocation_T* pVmaAllocation;
+    /// Sub-allocates set ranges, sets have arbitrary lifetimes like pool allocated ones
+    VmaVirtualBlock pVirtualBlock;
+    uint8_t* pMappedData;
+    VkDeviceAddress mAddress;
+    VkDeviceSize mSize;
+    VkDeviceSize mOffsetAlignment;
+    /// Lock for multi-threaded set allocations
+    struct SMutex* pMutex;
+} VkUtil_DescriptorBuffer;
+
+#if VK_EXT_descriptor_buffer
+    #define CGPU_VK_DESCRIPTOR_BUFFER_LAYOUT_FLAGS VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+    #define CGPU_VK_DESCRIPTOR_BUFFER_PIPELINE_FLAGS VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+#else
+    #define CGPU_VK_DESCRIPTOR_BUFFER_LAYOUT_FLAGS 0
+    #define CGPU_VK_DESCRIPTOR_BUFFER_PIPELINE_FLAGS 0
+#endif
+// Upper bound of the device descriptor buffer, clamped to the address space limits
+#define CGPU_VK_DESCRIPTOR_BUFFER_SIZE (16 * 1024 * 1024)
+
+typedef struct VkUtil_BindlessPendingFree {
+    uint64_t mFrame;
+    uint32_t mIndex;
+} VkUtil_BindlessPendingFree;
+
+typedef struct VkUtil_BindlessTable {
+    VkDescriptorType mType;
+    VkDescriptorSetLayout pLayout;
+    VkDescriptorSet pSet;
+    /// 0 if the class is disabled
+    uint32_t mCapacity;
+    /// Indices never handed out start here, the free list is used first
+    uint32_t mNextIndex;
+    uint32_t* pFreeIndices;
+    uint32_t mFreeCount;
+    /// Released indices waiting for their frame to complete, in frame order
+    VkUtil_BindlessPendingFree* pPendingFrees;
+    uint32_t mPendingCount;
+    uint32_t mPendingCapacity;
+} VkUtil_BindlessTable;
+
+typedef struct VkUtil_BindlessFrame {
+    uint64_t mFrame;
+    CGPUFenceId pFence;
+} VkUtil_BindlessFrame;
+
+typedef struct VkUtil_BindlessHeap {
+    CGPUDevice_Vulkan* Device;
+    VkDescriptorPool pVkDescPool;
+    VkUtil_BindlessTable mTables[CGPU_VK_BINDLESS_CLASS_COUNT];
+    uint64_t mFrameIndex;
+    /// Frames below this index are finished on the GPU
+    uint64_t mCompletedFrames;
+    VkUtil_BindlessFrame* pInFlightFrames;
+    uint32_t mInFlightCount;
+    uint32_t mInFlightCapacity;
+    /// Lock for multi-threaded registrations
+    struct SMutex* pMutex;
+} VkUtil_BindlessHeap;
+
+typedef struct VkUtil_TimelinePoint {
+    uint64_t mValue;
+    VkFence pVkFence;
+} VkUtil_TimelinePoint;
+
+// Timeline on devices without VK_KHR_timeline_semaphore, every GPU signal is a fence
+// submitted behind the work reaching its value
+typedef struct VkUtil_EmulatedTimeline {
+    CGPUDevice_Vulkan* Device;
+    uint64_t mCompletedValue;
+    /// Submitted signals not known to be finished, in submission order
+    VkUtil_TimelinePoint* pPendingPoints;
+    uint32_t mPendingCount;
+    uint32_t mPendingCapacity;
+    /// Unsignaled fences of retired points
+    VkFence* pFreeFences;
+    uint32_t mFreeCount;
+    uint32_t mFreeCapacity;
+    /// Lock for signals and waits from multiple threads
+    struct SMutex* pMutex;
+} VkUtil_EmulatedTimeline;
+
 #define CHECK_VKRESULT(logger, exp)                                                             \
     {                                                                                   \
         VkResult vkres = (exp);                                                         \
@@ -290,6 +443,9 @@ CGPU_UNUSED static const char* cgpu_wanted_device_exts[] = {
 #if VK_KHR_synchronization2
     VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
 #endif
+#if VK_KHR_timeline_semaphore
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+#endif
 #if VK_EXT_descriptor_buffer
     VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME,
 #endif
@@ -450,6 +450,59 @@ CGPU_FORCEINLINE static VkPipelineStageFlags VkUtil_DeterminePipelineStageFlags(
     return flags;
 }
 
+// Stages a queue family cannot execute are dropped, an empty result waits on all commands
+CGPU_FORCEINLINE static VkPipelineStageFlags VkUtil_TranslatePipelineStages(CGPUAdapter_Vulkan* A, ECGPUPipelineStageFlags stages, ECGPUQueueType queue_type)
+{
+    VkPipelineStageFlags flags = 0;
+    if (stages & CGPU_PIPELINE_STAGE_INDEX)
+        flags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+    if (stages & CGPU_PIPELINE_STAGE_VERTEX)
+    {
+        flags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+        if (A->adapter_detail.support_geom_shader)
+            flags |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+        if (A->adapter_detail.support_tessellation)
+            flags |= VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT;
+    }
+    if (stages & CGPU_PIPELINE_STAGE_FRAGMENT)
+        flags |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    if (stages & CGPU_PIPELINE_STAGE_DEPTH)
+        flags |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    if (stages & CGPU_PIPELINE_STAGE_RENDER_TARGET)
+        flags |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    if (stages & CGPU_PIPELINE_STAGE_COMPUTE)
+        flags |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+#ifdef ENABLE_RAYTRACING
+    if (stages & CGPU_PIPELINE_STAGE_RAY_TRACING)
+        flags |= VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR;
+#endif
+    if (stages & CGPU_PIPELINE_STAGE_COPY)
+        flags |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+    // Render pass resolves run as attachment writes, vkCmdResolveImage as a transfer
+    if (stages & CGPU_PIPELINE_STAGE_RESOLVE)
+        flags |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+    if (stages & CGPU_PIPELINE_STAGE_EXECUTE_INDIRECT)
+        flags |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+
+    switch (queue_type)
+    {
+        case CGPU_QUEUE_TYPE_COMPUTE:
+            flags &= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        case CGPU_QUEUE_TYPE_TRANSFER:
+            flags &= VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        default: break;
+    }
+    return flags ? flags : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+}
+
+// Explicit barrier stages replace the ones derived from the access mask
+CGPU_FORCEINLINE static VkPipelineStageFlags VkUtil_DetermineBarrierStageFlags(CGPUAdapter_Vulkan* A, ECGPUPipelineStageFlags stages, VkAccessFlags accessFlags, ECGPUQueueType queue_type)
+{
+    return stages ? VkUtil_TranslatePipelineStages(A, stages, queue_type) : VkUtil_DeterminePipelineStageFlags(A, accessFlags, queue_type);
+}
+
 CGPU_FORCEINLINE static VkAccessFlags VkUtil_ResourceStateToVkAccessFlags(ECGPUResourceStateFlags state)
 {
 	VkAccessFlags ret = VK_ACCESS_NONE;
@@ -254,6 +254,56 @@ void cgpu_device_free_semaphore(CGPUDeviceId device, CGPUSemaphoreId semaphore)
     fn_free_semaphore(device, semaphore);
 }
 
+CGPUTimelineSemaphoreId cgpu_device_create_timeline_semaphore(CGPUDeviceId device, uint64_t initial_value)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->create_timeline_semaphore && "create_timeline_semaphore Proc Missing!");
+    CGPUTimelineSemaphore* semaphore = (CGPUTimelineSemaphore*)device->proc_table_cache->create_timeline_semaphore(device, initial_value);
+    if (semaphore) semaphore->device = device;
+    return semaphore;
+}
+
+void cgpu_device_free_timeline_semaphore(CGPUDeviceId device, CGPUTimelineSemaphoreId semaphore)
+{
+    cgpu_assert(semaphore != CGPU_NULLPTR && "fatal: call on NULL timeline semaphore!");
+    cgpu_assert(semaphore->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    const CGPUProcFreeTimelineSemaphore fn_free_timeline_semaphore = semaphore->device->proc_table_cache->free_timeline_semaphore;
+    cgpu_assert(fn_free_timeline_semaphore && "free_timeline_semaphore Proc Missing!");
+    fn_free_timeline_semaphore(device, semaphore);
+}
+
+void cgpu_timeline_semaphore_signal(CGPUTimelineSemaphoreId semaphore, uint64_t value)
+{
+    cgpu_assert(semaphore != CGPU_NULLPTR && "fatal: call on NULL timeline semaphore!");
+    cgpu_assert(semaphore->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    const CGPUProcSignalTimelineSemaphore fn_signal_timeline_semaphore = semaphore->device->proc_table_cache->signal_timeline_semaphore;
+    cgpu_assert(fn_signal_timeline_semaphore && "signal_timeline_semaphore Proc Missing!");
+    fn_signal_timeline_semaphore(semaphore, value);
+}
+
+bool cgpu_wait_timeline_semaphores(uint32_t semaphore_count, const CGPUTimelineSemaphoreId* semaphores, const uint64_t* values, uint64_t timeout_ns)
+{
+    if (semaphores == CGPU_NULLPTR || semaphore_count <= 0)
+    {
+        return true;
+    }
+    CGPUTimelineSemaphoreId semaphore = semaphores[0];
+    cgpu_assert(semaphore != CGPU_NULLPTR && "fatal: call on NULL timeline semaphore!");
+    cgpu_assert(semaphore->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    const CGPUProcWaitTimelineSemaphores fn_wait_timeline_semaphores = semaphore->device->proc_table_cache->wait_timeline_semaphores;
+    cgpu_assert(fn_wait_timeline_semaphores && "wait_timeline_semaphores Proc Missing!");
+    return fn_wait_timeline_semaphores(semaphore_count, semaphores, values, timeout_ns);
+}
+
+uint64_t cgpu_timeline_semaphore_query_value(CGPUTimelineSemaphoreId semaphore)
+{
+    cgpu_assert(semaphore != CGPU_NULLPTR && "fatal: call on NULL timeline semaphore!");
+    cgpu_assert(semaphore->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    const CGPUProcQueryTimelineSemaphoreValue fn_query_timeline_semaphore_value = semaphore->device->proc_table_cache->query_timeline_semaphore_value;
+    cgpu_assert(fn_query_timeline_semaphore_value && "query_timeline_semaphore_value Proc Missing!");
+    return fn_query_timeline_semaphore_value(semaphore);
+}
+
 CGPURootSignatureId cgpu_device_create_root_signature(CGPUDeviceId device, const struct CGPURootSignatureDescriptor* desc)
 {
     // SkrCZoneN(zz, "CGPUCreateRootSignature", 1);
@@ -313,6 +363,7 @@ CGPUDescriptorSetId cgpu_device_create_descriptor_set(CGPUDeviceId device, const
     cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
     cgpu_assert(device->proc_table_cache->create_descriptor_set && "create_descriptor_set Proc Missing!");
     CGPUDescriptorSet* set = (CGPUDescriptorSet*)device->proc_table_cache->create_descriptor_set(device, desc);
+    if (set == CGPU_NULLPTR) return CGPU_NULLPTR;
     set->root_signature = desc->root_signature;
     set->index = desc->set_index;
 
@@ -321,6 +372,20 @@ CGPUDescriptorSetId cgpu_device_create_descriptor_set(CGPUDeviceId device, const
     return set;
 }
 
+uint32_t cgpu_root_signature_resolve_binding(const CGPURootSignatureId signature, const char* name)
+{
+    cgpu_assert(signature != CGPU_NULLPTR && "fatal: call on NULL root signature!");
+    cgpu_assert(name != CGPU_NULLPTR && "fatal: resolve binding with NULL name!");
+    return CGPUUtil_ResolveRSBinding(signature, name);
+}
+
+uint32_t cgpu_root_signature_resolve_push_constant(const CGPURootSignatureId signature, const char* name)
+{
+    cgpu_assert(signature != CGPU_NULLPTR && "fatal: call on NULL root signature!");
+    cgpu_assert(name != CGPU_NULLPTR && "fatal: resolve push constant with NULL name!");
+    return CGPUUtil_ResolvePushConstant(signature, name);
+}
+
 void cgpu_descriptor_set_update(CGPUDescriptorSetId set, uint32_t count, const struct CGPUDescriptorData* datas)
 {
     // SkrCZoneN(zz, "CGPUUpdateDescSet", 1);
@@ -346,6 +411,280 @@ void cgpu_device_free_descriptor_set(CGPUDeviceId device, CGPUDescriptorSetId se
     // SkrCZoneEnd(zz);
 }
 
+CGPUDescriptorArenaId cgpu_device_create_descriptor_arena(CGPUDeviceId device, const struct CGPUDescriptorArenaDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->create_descriptor_arena && "create_descriptor_arena Proc Missing!");
+    CGPUDescriptorArena* arena = (CGPUDescriptorArena*)device->proc_table_cache->create_descriptor_arena(device, desc);
+    arena->device = device;
+    return arena;
+}
+
+CGPUDescriptorSetId cgpu_descriptor_arena_allocate_set(CGPUDescriptorArenaId arena, const struct CGPUDescriptorSetDescriptor* desc)
+{
+    cgpu_assert(arena != CGPU_NULLPTR && "fatal: call on NULL descriptor arena!");
+    const CGPUDeviceId device = arena->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->descriptor_arena_allocate_set && "descriptor_arena_allocate_set Proc Missing!");
+    CGPUDescriptorSet* set = (CGPUDescriptorSet*)device->proc_table_cache->descriptor_arena_allocate_set(arena, desc);
+    if (set != CGPU_NULLPTR)
+    {
+        set->root_signature = desc->root_signature;
+        set->index = desc->set_index;
+    }
+    return set;
+}
+
+void cgpu_descriptor_arena_reset(CGPUDescriptorArenaId arena)
+{
+    cgpu_assert(arena != CGPU_NULLPTR && "fatal: call on NULL descriptor arena!");
+    const CGPUDeviceId device = arena->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->reset_descriptor_arena && "reset_descriptor_arena Proc Missing!");
+    device->proc_table_cache->reset_descriptor_arena(arena);
+}
+
+void cgpu_device_free_descriptor_arena(CGPUDeviceId device, CGPUDescriptorArenaId arena)
+{
+    cgpu_assert(arena != CGPU_NULLPTR && "fatal: call on NULL descriptor arena!");
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->free_descriptor_arena && "free_descriptor_arena Proc Missing!");
+    device->proc_table_cache->free_descriptor_arena(device, arena);
+}
+
+CGPUDescriptorSetCacheId cgpu_device_create_descriptor_set_cache(CGPUDeviceId device, const struct CGPUDescriptorSetCacheDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(desc != CGPU_NULLPTR && "fatal: create descriptor set cache with NULL descriptor!");
+    return CGPUUtil_CreateDescriptorSetCache(device, desc);
+}
+
+CGPUDescriptorSetId cgpu_descriptor_set_cache_acquire_set(CGPUDescriptorSetCacheId cache, const struct CGPUDescriptorSetDescriptor* desc, uint32_t count, const struct CGPUDescriptorData* datas)
+{
+    cgpu_assert(cache != CGPU_NULLPTR && "fatal: call on NULL descriptor set cache!");
+    cgpu_assert(desc != CGPU_NULLPTR && desc->root_signature != CGPU_NULLPTR && "fatal: acquire descriptor set with NULL root signature!");
+    return CGPUUtil_DescriptorSetCacheAcquire(cache, desc, count, datas);
+}
+
+void cgpu_descriptor_set_cache_advance_frame(CGPUDescriptorSetCacheId cache, CGPUFenceId fence)
+{
+    cgpu_assert(cache != CGPU_NULLPTR && "fatal: call on NULL descriptor set cache!");
+    CGPUUtil_DescriptorSetCacheAdvanceFrame(cache, fence);
+}
+
+void cgpu_descriptor_set_cache_clear(CGPUDescriptorSetCacheId cache)
+{
+    cgpu_assert(cache != CGPU_NULLPTR && "fatal: call on NULL descriptor set cache!");
+    CGPUUtil_DescriptorSetCacheClear(cache);
+}
+
+void cgpu_device_free_descriptor_set_cache(CGPUDeviceId device, CGPUDescriptorSetCacheId cache)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(cache != CGPU_NULLPTR && "fatal: call on NULL descriptor set cache!");
+    CGPUUtil_FreeDescriptorSetCache(cache);
+}
+
+CGPUCommandRingId cgpu_device_create_command_ring(CGPUDeviceId device, const struct CGPUCommandRingDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(desc != CGPU_NULLPTR && desc->queue != CGPU_NULLPTR && "fatal: create command ring with NULL queue!");
+    return CGPUUtil_CreateCommandRing(device, desc);
+}
+
+CGPUCommandBufferId cgpu_command_ring_acquire_command_buffer(CGPUCommandRingId ring, uint32_t thread_index, bool is_secondary)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL command ring!");
+    return CGPUUtil_CommandRingAcquire(ring, thread_index, is_secondary);
+}
+
+void cgpu_command_ring_advance_frame(CGPUCommandRingId ring, CGPUFenceId fence)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL command ring!");
+    CGPUUtil_CommandRingAdvanceFrame(ring, fence);
+}
+
+void cgpu_device_free_command_ring(CGPUDeviceId device, CGPUCommandRingId ring)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL command ring!");
+    CGPUUtil_FreeCommandRing(ring);
+}
+
+CGPUUploadRingId cgpu_device_create_upload_ring(CGPUDeviceId device, const struct CGPUUploadRingDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(desc != CGPU_NULLPTR && "fatal: create upload ring with NULL descriptor!");
+    return CGPUUtil_CreateUploadRing(device, desc);
+}
+
+bool cgpu_upload_ring_allocate(CGPUUploadRingId ring, uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL upload ring!");
+    cgpu_assert(allocation != CGPU_NULLPTR && "fatal: upload ring allocate with NULL output!");
+    return CGPUUtil_UploadRingAllocate(ring, size, alignment, allocation);
+}
+
+void cgpu_upload_ring_advance_frame(CGPUUploadRingId ring, CGPUFenceId fence)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL upload ring!");
+    CGPUUtil_UploadRingAdvanceFrame(ring, fence);
+}
+
+void cgpu_device_free_upload_ring(CGPUDeviceId device, CGPUUploadRingId ring)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL upload ring!");
+    CGPUUtil_FreeUploadRing(ring);
+}
+
+CGPUUploadQueueId cgpu_device_create_upload_queue(CGPUDeviceId device, const struct CGPUUploadQueueDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(desc != CGPU_NULLPTR && "fatal: create upload queue with NULL descriptor!");
+    cgpu_assert(desc->queue != CGPU_NULLPTR && "fatal: create upload queue with NULL queue!");
+    return CGPUUtil_CreateUploadQueue(device, desc);
+}
+
+uint64_t cgpu_upload_queue_upload_buffer(CGPUUploadQueueId queue, const struct CGPUBufferUpload* desc)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    cgpu_assert(desc != CGPU_NULLPTR && desc->buffer != CGPU_NULLPTR && "fatal: upload to NULL buffer!");
+    cgpu_assert(desc->offset + desc->size <= desc->buffer->info->size && "fatal: buffer upload out of range!");
+    return CGPUUtil_UploadQueueUploadBuffer(queue, desc);
+}
+
+uint64_t cgpu_upload_queue_upload_texture(CGPUUploadQueueId queue, const struct CGPUTextureUpload* desc)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    cgpu_assert(desc != CGPU_NULLPTR && desc->texture != CGPU_NULLPTR && "fatal: upload to NULL texture!");
+    cgpu_assert(desc->mip_level < desc->texture->info->mip_levels && "fatal: texture upload mip level out of range!");
+    cgpu_assert(desc->array_layer <= desc->texture->info->array_size_minus_one && "fatal: texture upload array layer out of range!");
+    return CGPUUtil_UploadQueueUploadTexture(queue, desc);
+}
+
+uint64_t cgpu_upload_queue_flush(CGPUUploadQueueId queue)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    return CGPUUtil_UploadQueueFlush(queue);
+}
+
+bool cgpu_upload_queue_is_complete(CGPUUploadQueueId queue, uint64_t token)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    return CGPUUtil_UploadQueueIsComplete(queue, token);
+}
+
+void cgpu_upload_queue_wait(CGPUUploadQueueId queue, uint64_t token)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    CGPUUtil_UploadQueueWait(queue, token);
+}
+
+void cgpu_upload_queue_record_acquire_barriers(CGPUUploadQueueId queue, CGPUCommandBufferId cmd, uint64_t token)
+{
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    cgpu_assert(cmd != CGPU_NULLPTR && "fatal: record acquire barriers on NULL command buffer!");
+    CGPUUtil_UploadQueueRecordAcquireBarriers(queue, cmd, token);
+}
+
+void cgpu_device_free_upload_queue(CGPUDeviceId device, CGPUUploadQueueId queue)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL upload queue!");
+    CGPUUtil_FreeUploadQueue(queue);
+}
+
+CGPUReadbackRingId cgpu_device_create_readback_ring(CGPUDeviceId device, const struct CGPUReadbackRingDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(desc != CGPU_NULLPTR && "fatal: create readback ring with NULL descriptor!");
+    return CGPUUtil_CreateReadbackRing(device, desc);
+}
+
+uint64_t cgpu_readback_ring_read_buffer(CGPUReadbackRingId ring, CGPUCommandBufferId cmd, const struct CGPUBufferReadback* desc)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    cgpu_assert(cmd != CGPU_NULLPTR && "fatal: read buffer on NULL command buffer!");
+    cgpu_assert(desc != CGPU_NULLPTR && desc->buffer != CGPU_NULLPTR && "fatal: read back NULL buffer!");
+    cgpu_assert(desc->size && desc->offset + desc->size <= desc->buffer->info->size && "fatal: buffer readback out of range!");
+    return CGPUUtil_ReadbackRingReadBuffer(ring, cmd, desc);
+}
+
+void cgpu_readback_ring_advance_frame(CGPUReadbackRingId ring, CGPUFenceId fence)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    CGPUUtil_ReadbackRingAdvanceFrame(ring, fence);
+}
+
+void cgpu_readback_ring_poll(CGPUReadbackRingId ring)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    CGPUUtil_ReadbackRingPoll(ring);
+}
+
+bool cgpu_readback_ring_is_ready(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    return CGPUUtil_ReadbackRingIsReady(ring, ticket);
+}
+
+const void* cgpu_readback_ring_map(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    return CGPUUtil_ReadbackRingMap(ring, ticket);
+}
+
+void cgpu_readback_ring_release(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    CGPUUtil_ReadbackRingRelease(ring, ticket);
+}
+
+void cgpu_device_free_readback_ring(CGPUDeviceId device, CGPUReadbackRingId ring)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(ring != CGPU_NULLPTR && "fatal: call on NULL readback ring!");
+    CGPUUtil_FreeReadbackRing(ring);
+}
+
+uint32_t cgpu_device_register_texture_view(CGPUDeviceId device, CGPUTextureViewId view)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(view != CGPU_NULLPTR && "fatal: register NULL texture view!");
+    cgpu_assert(device->proc_table_cache->register_bindless_texture_view && "register_bindless_texture_view Proc Missing!");
+    return device->proc_table_cache->register_bindless_texture_view(device, view);
+}
+
+uint32_t cgpu_device_register_buffer(CGPUDeviceId device, CGPUBufferId buffer)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: register NULL buffer!");
+    cgpu_assert(device->proc_table_cache->register_bindless_buffer && "register_bindless_buffer Proc Missing!");
+    return device->proc_table_cache->register_bindless_buffer(device, buffer);
+}
+
+void cgpu_device_unregister_texture_view(CGPUDeviceId device, uint32_t index)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->unregister_bindless_texture_view && "unregister_bindless_texture_view Proc Missing!");
+    device->proc_table_cache->unregister_bindless_texture_view(device, index);
+}
+
+void cgpu_device_unregister_buffer(CGPUDeviceId device, uint32_t index)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->unregister_bindless_buffer && "unregister_bindless_buffer Proc Missing!");
+    device->proc_table_cache->unregister_bindless_buffer(device, index);
+}
+
+void cgpu_device_advance_bindless_frame(CGPUDeviceId device, CGPUFenceId fence)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->advance_bindless_frame && "advance_bindless_frame Proc Missing!");
+    device->proc_table_cache->advance_bindless_frame(device, fence);
+}
+
 CGPUComputePipelineId cgpu_device_create_compute_pipeline(CGPUDeviceId device, const struct CGPUComputePipelineDescriptor* desc)
 {
     // SkrCZoneN(zz, "CGPUCreatePSO(C)", 1);
@@ -451,6 +790,36 @@ void cgpu_device_free_query_pool(CGPUDeviceId device, CGPUQueryPoolId pool)
     fn_free_query_pool(device, pool);
 }
 
+CGPUMemoryPoolId cgpu_device_create_memory_pool(CGPUDeviceId device, const struct CGPUMemoryPoolDescriptor* desc)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    CGPUProcCreateMemoryPool fn_create_memory_pool = device->proc_table_cache->create_memory_pool;
+    cgpu_assert(fn_create_memory_pool && "create_memory_pool Proc Missing!");
+    CGPUMemoryPool* memory_pool = (CGPUMemoryPool*)fn_create_memory_pool(device, desc);
+    if (memory_pool == CGPU_NULLPTR) return CGPU_NULLPTR;
+    memory_pool->device = device;
+    memory_pool->type = desc->type;
+    return memory_pool;
+}
+
+void cgpu_device_free_memory_pool(CGPUDeviceId device, CGPUMemoryPoolId pool)
+{
+    cgpu_assert(pool != CGPU_NULLPTR && "fatal: call on NULL pool!");
+    cgpu_assert(pool->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    CGPUProcFreeMemoryPool fn_free_memory_pool = pool->device->proc_table_cache->free_memory_pool;
+    cgpu_assert(fn_free_memory_pool && "free_memory_pool Proc Missing!");
+    fn_free_memory_pool(device, pool);
+}
+
+void cgpu_memory_pool_query_statistics(CGPUMemoryPoolId pool, CGPUMemoryPoolStatistics* stats)
+{
+    cgpu_assert(pool != CGPU_NULLPTR && "fatal: call on NULL pool!");
+    cgpu_assert(pool->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    CGPUProcQueryMemoryPoolStatistics fn_query_memory_pool_statistics = pool->device->proc_table_cache->query_memory_pool_statistics;
+    cgpu_assert(fn_query_memory_pool_statistics && "query_memory_pool_statistics Proc Missing!");
+    fn_query_memory_pool_statistics(pool, stats);
+}
+
 void cgpu_adapter_free_device(CGPUAdapterId adapter, CGPUDeviceId device)
 {
     cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
@@ -460,6 +829,22 @@ void cgpu_adapter_free_device(CGPUAdapterId adapter, CGPUDeviceId device)
     return;
 }
 
+size_t cgpu_device_get_pipeline_cache_data(CGPUDeviceId device, size_t size, void* data)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->get_pipeline_cache_data && "get_pipeline_cache_data Proc Missing!");
+
+    return device->proc_table_cache->get_pipeline_cache_data(device, size, data);
+}
+
+void cgpu_device_query_descriptor_pool_stats(CGPUDeviceId device, CGPUDescriptorPoolStats* stats)
+{
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->query_descriptor_pool_stats && "query_descriptor_pool_stats Proc Missing!");
+
+    device->proc_table_cache->query_descriptor_pool_stats(device, stats);
+}
+
 CGPUQueueId cgpu_device_get_queue(CGPUDeviceId device, ECGPUQueueType type, uint32_t index)
 {
     cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
@@ -492,6 +877,17 @@ ECGPUSubmitError cgpu_queue_submit(CGPUQueueId queue, const struct CGPUQueueSubm
     return submit_queue(queue, desc);
 }
 
+ECGPUSubmitError cgpu_queue_submit_batches(CGPUQueueId queue, uint32_t batch_count, const struct CGPUQueueSubmitDescriptor* descs)
+{
+    cgpu_assert((batch_count == 0 || descs != CGPU_NULLPTR) && "fatal: call on NULL descs!");
+    cgpu_assert(queue != CGPU_NULLPTR && "fatal: call on NULL queue!");
+    cgpu_assert(queue->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    const CGPUProcSubmitQueueBatches submit_queue_batches = queue->device->proc_table_cache->submit_queue_batches;
+    cgpu_assert(submit_queue_batches && "submit_queue_batches Proc Missing!");
+
+    return submit_queue_batches(queue, batch_count, descs);
+}
+
 ECGPUPresentError cgpu_queue_present(CGPUQueueId queue, const struct CGPUQueuePresentDescriptor* desc)
 {
     // SkrCZoneN(zz, "CGPUPresent", 1);
@@ -690,6 +1086,32 @@ void cgpu_command_buffer_begin(CGPUCommandBufferId cmd)
     fn_cmd_begin(cmd);
 }
 
+CGPURenderPassEncoderId cgpu_command_buffer_begin_secondary(CGPUCommandBufferId cmd, const CGPUCommandBufferInheritanceInfo* inheritance)
+{
+    cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
+    cgpu_assert(cmd->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(inheritance != CGPU_NULLPTR && "fatal: begin secondary with NULL inheritance info!");
+    const CGPUProcCmdBeginSecondary fn_cmd_begin_secondary = cmd->device->proc_table_cache->cmd_begin_secondary;
+    cgpu_assert(fn_cmd_begin_secondary && "cmd_begin_secondary Proc Missing!");
+    CGPURenderPassEncoderId ecd = fn_cmd_begin_secondary(cmd, inheritance);
+    if (ecd != CGPU_NULLPTR)
+    {
+        CGPUCommandBuffer* Cmd = (CGPUCommandBuffer*)cmd;
+        Cmd->current_dispatch = CGPU_PIPELINE_TYPE_GRAPHICS;
+    }
+    return ecd;
+}
+
+void cgpu_command_buffer_execute_secondaries(CGPUCommandBufferId cmd, uint32_t count, const CGPUCommandBufferId* secondaries)
+{
+    cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
+    cgpu_assert(cmd->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert((count == 0 || secondaries != CGPU_NULLPTR) && "fatal: execute NULL secondaries!");
+    const CGPUProcCmdExecuteSecondaries fn_cmd_execute_secondaries = cmd->device->proc_table_cache->cmd_execute_secondaries;
+    cgpu_assert(fn_cmd_execute_secondaries && "cmd_execute_secondaries Proc Missing!");
+    fn_cmd_execute_secondaries(cmd, count, secondaries);
+}
+
 void cgpu_command_buffer_transfer_buffer_to_buffer(CGPUCommandBufferId cmd, const struct CGPUBufferToBufferTransfer* desc)
 {
     cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
@@ -797,6 +1219,16 @@ void cgpu_command_buffer_end(CGPUCommandBufferId cmd)
     fn_cmd_end(cmd);
 }
 
+void cgpu_command_buffer_query_statistics(CGPUCommandBufferId cmd, CGPUCommandBufferStatistics* stats)
+{
+    cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
+    cgpu_assert(cmd->device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(stats != CGPU_NULLPTR && "fatal: query command buffer statistics with NULL output!");
+    const CGPUProcQueryCommandBufferStatistics fn_query_statistics = cmd->device->proc_table_cache->query_command_buffer_statistics;
+    cgpu_assert(fn_query_statistics && "query_command_buffer_statistics Proc Missing!");
+    fn_query_statistics(cmd, stats);
+}
+
 // Compute CMDs
 CGPUComputePassEncoderId cgpu_command_buffer_begin_compute_pass(CGPUCommandBufferId cmd, const struct CGPUComputePassDescriptor* desc)
 {
@@ -831,6 +1263,16 @@ void cgpu_compute_pass_encoder_push_constants(CGPUComputePassEncoderId encoder,
     fn_push_constants(encoder, rs, name, data);
 }
 
+void cgpu_compute_pass_encoder_push_constant_range(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(slot < rs->push_constant_count && "fatal: invalid push constant slot!");
+    const CGPUProcComputeEncoderPushConstantRange fn_push_constant_range = device->proc_table_cache->compute_encoder_push_constant_range;
+    cgpu_assert(fn_push_constant_range && "compute_encoder_push_constant_range Proc Missing!");
+    fn_push_constant_range(encoder, rs, slot, offset, size, data);
+}
+
 void cgpu_compute_pass_encoder_bind_compute_pipeline(CGPUComputePassEncoderId encoder, CGPUComputePipelineId pipeline)
 {
     CGPUDeviceId device = encoder->device;
@@ -849,6 +1291,16 @@ void cgpu_compute_pass_encoder_dispatch(CGPUComputePassEncoderId encoder, uint32
     fn_compute_dispatch(encoder, X, Y, Z);
 }
 
+void cgpu_compute_pass_encoder_dispatch_indirect(CGPUComputePassEncoderId encoder, CGPUBufferId buffer, uint64_t offset)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: dispatch indirect with NULL buffer!");
+    const CGPUProcComputeEncoderDispatchIndirect fn_dispatch_indirect = device->proc_table_cache->compute_encoder_dispatch_indirect;
+    cgpu_assert(fn_dispatch_indirect && "compute_encoder_dispatch_indirect Proc Missing!");
+    fn_dispatch_indirect(encoder, buffer, offset);
+}
+
 void cgpu_command_buffer_end_compute_pass(CGPUCommandBufferId cmd, CGPUComputePassEncoderId encoder)
 {
     cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
@@ -955,6 +1407,16 @@ void cgpu_render_pass_encoder_push_constants(CGPURenderPassEncoderId encoder, CG
     fn_push_constants(encoder, rs, name, data);
 }
 
+void cgpu_render_pass_encoder_push_constant_range(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(slot < rs->push_constant_count && "fatal: invalid push constant slot!");
+    const CGPUProcRenderEncoderPushConstantRange fn_push_constant_range = device->proc_table_cache->render_encoder_push_constant_range;
+    cgpu_assert(fn_push_constant_range && "render_encoder_push_constant_range Proc Missing!");
+    fn_push_constant_range(encoder, rs, slot, offset, size, data);
+}
+
 void cgpu_render_pass_encoder_draw(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex)
 {
     CGPUDeviceId device = encoder->device;
@@ -991,6 +1453,48 @@ void cgpu_render_pass_encoder_draw_indexed_instanced(CGPURenderPassEncoderId enc
     fn_draw_indexed_instanced(encoder, index_count, first_index, instance_count, first_instance, first_vertex);
 }
 
+void cgpu_render_pass_encoder_draw_indirect(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: draw indirect with NULL buffer!");
+    const CGPUProcRenderEncoderDrawIndirect fn_draw_indirect = device->proc_table_cache->render_encoder_draw_indirect;
+    cgpu_assert(fn_draw_indirect && "render_encoder_draw_indirect Proc Missing!");
+    fn_draw_indirect(encoder, buffer, offset, draw_count, stride);
+}
+
+void cgpu_render_pass_encoder_draw_indexed_indirect(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: draw indirect with NULL buffer!");
+    const CGPUProcRenderEncoderDrawIndexedIndirect fn_draw_indexed_indirect = device->proc_table_cache->render_encoder_draw_indexed_indirect;
+    cgpu_assert(fn_draw_indexed_indirect && "render_encoder_draw_indexed_indirect Proc Missing!");
+    fn_draw_indexed_indirect(encoder, buffer, offset, draw_count, stride);
+}
+
+void cgpu_render_pass_encoder_draw_indirect_count(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: draw indirect with NULL buffer!");
+    cgpu_assert(count_buffer != CGPU_NULLPTR && "fatal: draw indirect count with NULL count buffer!");
+    const CGPUProcRenderEncoderDrawIndirectCount fn_draw_indirect_count = device->proc_table_cache->render_encoder_draw_indirect_count;
+    cgpu_assert(fn_draw_indirect_count && "render_encoder_draw_indirect_count Proc Missing!");
+    fn_draw_indirect_count(encoder, buffer, offset, count_buffer, count_buffer_offset, max_draw_count, stride);
+}
+
+void cgpu_render_pass_encoder_draw_indexed_indirect_count(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride)
+{
+    CGPUDeviceId device = encoder->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: draw indirect with NULL buffer!");
+    cgpu_assert(count_buffer != CGPU_NULLPTR && "fatal: draw indirect count with NULL count buffer!");
+    const CGPUProcRenderEncoderDrawIndexedIndirectCount fn_draw_indexed_indirect_count = device->proc_table_cache->render_encoder_draw_indexed_indirect_count;
+    cgpu_assert(fn_draw_indexed_indirect_count && "render_encoder_draw_indexed_indirect_count Proc Missing!");
+    fn_draw_indexed_indirect_count(encoder, buffer, offset, count_buffer, count_buffer_offset, max_draw_count, stride);
+}
+
 void cgpu_command_buffer_end_render_pass(CGPUCommandBufferId cmd, CGPURenderPassEncoderId encoder)
 {
     cgpu_assert(cmd != CGPU_NULLPTR && "fatal: call on NULL cmdbuffer!");
@@ -1111,6 +1615,17 @@ void cgpu_buffer_unmap(CGPUBufferId buffer)
     fn_unmap_buffer(buffer);
 }
 
+void cgpu_buffer_invalidate(CGPUBufferId buffer, const struct CGPUBufferRange* range)
+{
+    cgpu_assert(buffer != CGPU_NULLPTR && "fatal: call on NULL buffer!");
+    const CGPUDeviceId device = buffer->device;
+    cgpu_assert(device != CGPU_NULLPTR && "fatal: call on NULL device!");
+    cgpu_assert(device->proc_table_cache->invalidate_buffer && "invalidate_buffer Proc Missing!");
+
+    CGPUProcInvalidateBuffer fn_invalidate_buffer = device->proc_table_cache->invalidate_buffer;
+    fn_invalidate_buffer(buffer, range);
+}
+
 void cgpu_device_free_buffer(CGPUDeviceId device, CGPUBufferId buffer)
 {
     // SkrCZoneN(zz, "CGPUFreeBuffer", 1);
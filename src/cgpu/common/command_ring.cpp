@@ -0,0 +1,127 @@
+#include "cgpu/api.h"
+#include "common_utils.h"
+#include "atomic.h"
+#include <vector>
+
+class CGPUCommandRingImpl : public CGPUCommandRing
+{
+public:
+    static constexpr uint32_t kDefaultFrameCount = 3;
+    // Buffers are never freed before the ring, so steady state acquires do not allocate
+    struct ThreadPool
+    {
+        CGPUCommandPoolId pool = nullptr;
+        std::vector<CGPUCommandBufferId> buffers[2];
+        uint32_t used[2] = { 0, 0 };
+    };
+    struct FrameSlot
+    {
+        CGPUFenceId fence = nullptr;
+        std::vector<ThreadPool> threads;
+    };
+
+    CGPUCommandRingImpl(CGPUDeviceId device, const CGPUCommandRingDescriptor* desc)
+        : frame_count(desc->frame_count ? desc->frame_count : kDefaultFrameCount)
+        , thread_count(desc->thread_count ? desc->thread_count : 1)
+    {
+        this->device = device;
+        this->queue = desc->queue;
+        this->frame_index = 0;
+        this->command_buffer_count = 0;
+        frames.resize(frame_count);
+        for (auto&& frame : frames)
+        {
+            frame.threads.resize(thread_count);
+        }
+    }
+    ~CGPUCommandRingImpl()
+    {
+        for (auto&& frame : frames)
+        {
+            if (frame.fence && cgpu_fence_query_status(frame.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                cgpu_wait_fences(1, &frame.fence);
+            for (auto&& thread : frame.threads)
+            {
+                if (!thread.pool) continue;
+                for (auto&& buffers : thread.buffers)
+                {
+                    for (auto&& cmd : buffers)
+                    {
+                        cgpu_command_pool_free_command_buffer(thread.pool, cmd);
+                    }
+                }
+                cgpu_queue_free_command_pool(queue, thread.pool);
+            }
+        }
+    }
+    CGPUCommandBufferId acquire(uint32_t thread_index, bool is_secondary)
+    {
+        ThreadPool& thread = frames[frame_index % frame_count].threads[thread_index];
+        if (!thread.pool)
+        {
+            CGPUCommandPoolDescriptor pool_desc = { "CommandRing" };
+            thread.pool = cgpu_queue_create_command_pool(queue, &pool_desc);
+            if (!thread.pool) return nullptr;
+        }
+        auto& buffers = thread.buffers[is_secondary];
+        uint32_t& used = thread.used[is_secondary];
+        if (used == buffers.size())
+        {
+            CGPUCommandBufferDescriptor cmd_desc = { is_secondary };
+            CGPUCommandBufferId cmd = cgpu_command_pool_create_command_buffer(thread.pool, &cmd_desc);
+            if (!cmd) return nullptr;
+            buffers.push_back(cmd);
+            // Shared by every thread index, unlike the rest of the per-thread state
+            skr_atomicu32_add_relaxed((SAtomicU32*)&command_buffer_count, 1);
+        }
+        return buffers[used++];
+    }
+    void advance_frame(CGPUFenceId fence)
+    {
+        frames[frame_index % frame_count].fence = fence;
+        frame_index++;
+        FrameSlot& next = frames[frame_index % frame_count];
+        // A null or unsubmitted fence stands for command buffers that are already idle
+        if (next.fence && cgpu_fence_query_status(next.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+            cgpu_wait_fences(1, &next.fence);
+        next.fence = nullptr;
+        for (auto&& thread : next.threads)
+        {
+            if (thread.used[0] + thread.used[1] == 0) continue;
+            cgpu_command_pool_reset(thread.pool);
+            thread.used[0] = 0;
+            thread.used[1] = 0;
+        }
+    }
+    uint32_t get_thread_count() const { return thread_count; }
+protected:
+    const uint32_t frame_count;
+    const uint32_t thread_count;
+    std::vector<FrameSlot> frames;
+};
+
+CGPUCommandRingId CGPUUtil_CreateCommandRing(CGPUDeviceId device, const CGPUCommandRingDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    return cgpu_new_aligned<CGPUCommandRingImpl>(allocator, device, desc);
+}
+
+CGPUCommandBufferId CGPUUtil_CommandRingAcquire(CGPUCommandRingId ring, uint32_t thread_index, bool is_secondary)
+{
+    auto R = (CGPUCommandRingImpl*)ring;
+    cgpu_assert(thread_index < R->get_thread_count() && "fatal: command ring thread index out of range!");
+    return R->acquire(thread_index, is_secondary);
+}
+
+void CGPUUtil_CommandRingAdvanceFrame(CGPUCommandRingId ring, CGPUFenceId fence)
+{
+    auto R = (CGPUCommandRingImpl*)ring;
+    R->advance_frame(fence);
+}
+
+void CGPUUtil_FreeCommandRing(CGPUCommandRingId ring)
+{
+    const CGPUAllocator* allocator = &ring->device->adapter->instance->allocator;
+    auto R = (CGPUCommandRingImpl*)ring;
+    cgpu_delete(allocator, R);
+}
@@ -0,0 +1,182 @@
+#include "cgpu/api.h"
+#include "common_utils.h"
+#include "parallel_hashmap/phmap.h"
+#include <deque>
+#include <list>
+#include <vector>
+
+class CGPUDescriptorSetCacheImpl : public CGPUDescriptorSetCache
+{
+public:
+    static constexpr uint32_t kDefaultCapacity = 4096;
+    struct Entry
+    {
+        size_t hash;
+        std::vector<uint64_t> key;
+        CGPUDescriptorSetId set;
+        uint64_t last_used_frame;
+    };
+    using EntryList = std::list<Entry>;
+    struct InFlightFrame
+    {
+        uint64_t frame;
+        CGPUFenceId fence;
+    };
+
+    CGPUDescriptorSetCacheImpl(CGPUDeviceId device, uint32_t capacity)
+        : capacity(capacity ? capacity : kDefaultCapacity)
+    {
+        this->device = device;
+        this->set_count = 0;
+        this->hit_count = 0;
+        this->miss_count = 0;
+    }
+    ~CGPUDescriptorSetCacheImpl()
+    {
+        clear();
+    }
+    // Flattens everything the descriptor writes depend on, resources are keyed by handle
+    void build_key(const CGPUParameterTable* table, uint32_t table_index, const CGPUDescriptorSetDescriptor* desc, uint32_t count, const CGPUDescriptorData* datas)
+    {
+        key_scratch.clear();
+        key_scratch.push_back((uint64_t)(uintptr_t)desc->root_signature);
+        key_scratch.push_back(desc->set_index);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const CGPUDescriptorData& data = datas[i];
+            const CGPUShaderResource* resource = table ? CGPUUtil_FindDescriptorResource(table, table_index, &data) : nullptr;
+            const uint32_t array_count = cgpu_max(1u, data.count);
+            const uint64_t binding = resource ? resource->binding : data.binding;
+            key_scratch.push_back((binding << 32) | array_count);
+            for (uint32_t arr = 0; arr < array_count; arr++)
+            {
+                key_scratch.push_back((uint64_t)(uintptr_t)data.resources.ptrs[arr]);
+            }
+            const ECGPUResourceTypeFlags type = resource ? resource->type : data.binding_type;
+            const bool is_buffer = type & (CGPU_RESOURCE_TYPE_UNIFORM_BUFFER | CGPU_RESOURCE_TYPE_BUFFER | CGPU_RESOURCE_TYPE_BUFFER_RAW |
+                                           CGPU_RESOURCE_TYPE_RW_BUFFER | CGPU_RESOURCE_TYPE_RW_BUFFER_RAW);
+            if (is_buffer && data.params.buffers_params.offsets)
+            {
+                for (uint32_t arr = 0; arr < array_count; arr++)
+                {
+                    key_scratch.push_back(data.params.buffers_params.offsets[arr]);
+                    key_scratch.push_back(data.params.buffers_params.sizes[arr]);
+                }
+            }
+        }
+    }
+    CGPUDescriptorSetId acquire(const CGPUDescriptorSetDescriptor* desc, uint32_t count, const CGPUDescriptorData* datas)
+    {
+        const CGPURootSignature* RS = desc->root_signature;
+        const CGPUParameterTable* table = nullptr;
+        uint32_t table_index = 0;
+        for (uint32_t i = 0; i < RS->table_count; i++)
+        {
+            if (RS->p_tables[i].set_index == desc->set_index)
+            {
+                table = &RS->p_tables[i];
+                table_index = i;
+                break;
+            }
+        }
+        build_key(table, table_index, desc, count, datas);
+        const size_t hash = cgpu_hash(key_scratch.data(), key_scratch.size() * sizeof(uint64_t), CGPU_NAME_HASH_SEED);
+        auto found = entry_map.find(hash);
+        if (found != entry_map.end() && found->second->key == key_scratch)
+        {
+            found->second->last_used_frame = frame_index;
+            entries.splice(entries.begin(), entries, found->second);
+            hit_count++;
+            return found->second->set;
+        }
+        // a hash collision leaves the previous entry to plain LRU eviction
+        CGPUDescriptorSetId set = cgpu_device_create_descriptor_set(device, desc);
+        if (set == CGPU_NULLPTR) return CGPU_NULLPTR;
+        cgpu_descriptor_set_update(set, count, datas);
+        entries.push_front(Entry{ hash, key_scratch, set, frame_index });
+        entry_map[hash] = entries.begin();
+        miss_count++;
+        evict();
+        return set;
+    }
+    void advance_frame(CGPUFenceId fence)
+    {
+        in_flight_frames.push_back(InFlightFrame{ frame_index, fence });
+        frame_index++;
+        while (!in_flight_frames.empty())
+        {
+            const InFlightFrame& oldest = in_flight_frames.front();
+            if (oldest.fence && cgpu_fence_query_status(oldest.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                break;
+            completed_frames = oldest.frame + 1;
+            in_flight_frames.pop_front();
+        }
+        evict();
+    }
+    // Only sets whose last frame has completed on the GPU can be freed, so capacity is a soft limit
+    void evict()
+    {
+        while (entries.size() > capacity)
+        {
+            Entry& oldest = entries.back();
+            if (oldest.last_used_frame >= completed_frames)
+                break;
+            auto found = entry_map.find(oldest.hash);
+            if (found != entry_map.end() && found->second == std::prev(entries.end()))
+                entry_map.erase(found);
+            cgpu_device_free_descriptor_set(device, oldest.set);
+            entries.pop_back();
+        }
+        set_count = (uint32_t)entries.size();
+    }
+    void clear()
+    {
+        for (auto&& entry : entries)
+        {
+            cgpu_device_free_descriptor_set(device, entry.set);
+        }
+        entries.clear();
+        entry_map.clear();
+        set_count = 0;
+    }
+protected:
+    const uint32_t capacity;
+    uint64_t frame_index = 0;
+    uint64_t completed_frames = 0;
+    std::vector<uint64_t> key_scratch;
+    // front is the most recently used
+    EntryList entries;
+    phmap::flat_hash_map<size_t, EntryList::iterator> entry_map;
+    std::deque<InFlightFrame> in_flight_frames;
+};
+
+CGPUDescriptorSetCacheId CGPUUtil_CreateDescriptorSetCache(CGPUDeviceId device, const CGPUDescriptorSetCacheDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    return cgpu_new_aligned<CGPUDescriptorSetCacheImpl>(allocator, device, desc->capacity);
+}
+
+CGPUDescriptorSetId CGPUUtil_DescriptorSetCacheAcquire(CGPUDescriptorSetCacheId cache, const CGPUDescriptorSetDescriptor* desc, uint32_t count, const CGPUDescriptorData* datas)
+{
+    auto C = (CGPUDescriptorSetCacheImpl*)cache;
+    return C->acquire(desc, count, datas);
+}
+
+void CGPUUtil_DescriptorSetCacheAdvanceFrame(CGPUDescriptorSetCacheId cache, CGPUFenceId fence)
+{
+    auto C = (CGPUDescriptorSetCacheImpl*)cache;
+    C->advance_frame(fence);
+}
+
+void CGPUUtil_DescriptorSetCacheClear(CGPUDescriptorSetCacheId cache)
+{
+    auto C = (CGPUDescriptorSetCacheImpl*)cache;
+    C->clear();
+}
+
+void CGPUUtil_FreeDescriptorSetCache(CGPUDescriptorSetCacheId cache)
+{
+    const CGPUAllocator* allocator = &cache->device->adapter->instance->allocator;
+    auto C = (CGPUDescriptorSetCacheImpl*)cache;
+    cgpu_delete(allocator, C);
+}
@@ -24,6 +24,18 @@ bool cgpu_runtime_table_remove_custom_data(CGPURuntimeTable* table, const char*
 
 void CGPUUtil_InitRSParamTables(CGPURootSignature* RS, const struct CGPURootSignatureDescriptor* desc, const CGPUAllocator* allocator);
 void CGPUUtil_FreeRSParamTables(CGPURootSignature* RS);
+// O(1) lookup through the table hash index, returns UINT32_MAX if not found
+uint32_t CGPUUtil_FindParamTableResource(const CGPUParameterTable* table, uint64_t name_hash);
+uint32_t CGPUUtil_ResolveRSBinding(const CGPURootSignature* RS, const char* name);
+// Index into p_push_constants, a NULL name selects the first block
+uint32_t CGPUUtil_ResolvePushConstant(const CGPURootSignature* RS, const char* name);
+// Resolved slot first, then the name hash index, then a scan of the bindings
+const CGPUShaderResource* CGPUUtil_FindDescriptorResource(const CGPUParameterTable* table, uint32_t table_index, const CGPUDescriptorData* data);
+
+// binding slot: (table index + 1) << 16 | resource index, 0 is CGPU_INVALID_BINDING_SLOT
+#define CGPU_BINDING_SLOT_MAKE(table_index, resource_index) ((((table_index) + 1) << 16) | (resource_index))
+#define CGPU_BINDING_SLOT_TABLE(slot) (((slot) >> 16) - 1)
+#define CGPU_BINDING_SLOT_RESOURCE(slot) ((slot) & 0xFFFF)
 
 // check for slot-overlapping and try get a signature from pool
 CGPURootSignaturePoolId CGPUUtil_CreateRootSignaturePool(const CGPUAllocator* allocator, const CGPURootSignaturePoolDescriptor* desc);
@@ -34,6 +46,37 @@ CGPURootSignatureId CGPUUtil_AddSignature(CGPURootSignaturePoolId pool, CGPURoot
 bool CGPUUtil_PoolFreeSignature(CGPURootSignaturePoolId pool, CGPURootSignatureId sig);
 void CGPUUtil_FreeRootSignaturePool(const CGPUAllocator* allocator, CGPURootSignaturePoolId pool);
 
+// descriptor set cache, backend independent
+CGPUDescriptorSetCacheId CGPUUtil_CreateDescriptorSetCache(CGPUDeviceId device, const CGPUDescriptorSetCacheDescriptor* desc);
+CGPUDescriptorSetId CGPUUtil_DescriptorSetCacheAcquire(CGPUDescriptorSetCacheId cache, const CGPUDescriptorSetDescriptor* desc, uint32_t count, const CGPUDescriptorData* datas);
+void CGPUUtil_DescriptorSetCacheAdvanceFrame(CGPUDescriptorSetCacheId cache, CGPUFenceId fence);
+void CGPUUtil_DescriptorSetCacheClear(CGPUDescriptorSetCacheId cache);
+void CGPUUtil_FreeDescriptorSetCache(CGPUDescriptorSetCacheId cache);
+CGPUCommandRingId CGPUUtil_CreateCommandRing(CGPUDeviceId device, const CGPUCommandRingDescriptor* desc);
+CGPUCommandBufferId CGPUUtil_CommandRingAcquire(CGPUCommandRingId ring, uint32_t thread_index, bool is_secondary);
+void CGPUUtil_CommandRingAdvanceFrame(CGPUCommandRingId ring, CGPUFenceId fence);
+void CGPUUtil_FreeCommandRing(CGPUCommandRingId ring);
+CGPUUploadRingId CGPUUtil_CreateUploadRing(CGPUDeviceId device, const CGPUUploadRingDescriptor* desc);
+bool CGPUUtil_UploadRingAllocate(CGPUUploadRingId ring, uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation);
+void CGPUUtil_UploadRingAdvanceFrame(CGPUUploadRingId ring, CGPUFenceId fence);
+void CGPUUtil_FreeUploadRing(CGPUUploadRingId ring);
+CGPUUploadQueueId CGPUUtil_CreateUploadQueue(CGPUDeviceId device, const CGPUUploadQueueDescriptor* desc);
+uint64_t CGPUUtil_UploadQueueUploadBuffer(CGPUUploadQueueId queue, const CGPUBufferUpload* desc);
+uint64_t CGPUUtil_UploadQueueUploadTexture(CGPUUploadQueueId queue, const CGPUTextureUpload* desc);
+uint64_t CGPUUtil_UploadQueueFlush(CGPUUploadQueueId queue);
+bool CGPUUtil_UploadQueueIsComplete(CGPUUploadQueueId queue, uint64_t token);
+void CGPUUtil_UploadQueueWait(CGPUUploadQueueId queue, uint64_t token);
+void CGPUUtil_UploadQueueRecordAcquireBarriers(CGPUUploadQueueId queue, CGPUCommandBufferId cmd, uint64_t token);
+void CGPUUtil_FreeUploadQueue(CGPUUploadQueueId queue);
+CGPUReadbackRingId CGPUUtil_CreateReadbackRing(CGPUDeviceId device, const CGPUReadbackRingDescriptor* desc);
+uint64_t CGPUUtil_ReadbackRingReadBuffer(CGPUReadbackRingId ring, CGPUCommandBufferId cmd, const CGPUBufferReadback* desc);
+void CGPUUtil_ReadbackRingAdvanceFrame(CGPUReadbackRingId ring, CGPUFenceId fence);
+void CGPUUtil_ReadbackRingPoll(CGPUReadbackRingId ring);
+bool CGPUUtil_ReadbackRingIsReady(CGPUReadbackRingId ring, uint64_t ticket);
+const void* CGPUUtil_ReadbackRingMap(CGPUReadbackRingId ring, uint64_t ticket);
+void CGPUUtil_ReadbackRingRelease(CGPUReadbackRingId ring, uint64_t ticket);
+void CGPUUtil_FreeReadbackRing(CGPUReadbackRingId ring);
+
 #define cgpu_round_up(value, multiple) ((((value) + (multiple)-1) / (multiple)) * (multiple))
 #define cgpu_round_down(value, multiple) ((value) - (value) % (multiple))
 
@@ -43,6 +86,14 @@ CGPU_EXTERN_C_END
 
 #define CGPU_CULL_MODE_COUNT 3
 
+#if defined(__cplusplus)
+    #define CGPU_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define CGPU_THREAD_LOCAL __declspec(thread)
+#else
+    #define CGPU_THREAD_LOCAL _Thread_local
+#endif
+
 
 #ifndef cgpu_max
     #define cgpu_max(a, b) (((a) > (b)) ? (a) : (b))
@@ -142,6 +193,7 @@ CGPU_EXTERN_C void cgpu_free_aligned_default(void* user_data, void* ptr, const v
 #define cgpu_malloc(allocator, size) (allocator)->malloc_fn((allocator)->user_data, size, 0)
 #define cgpu_malloc_aligned(allocator, size, alignment) (allocator)->malloc_aligned_fn((allocator)->user_data, size, alignment, 0)
 #define cgpu_malloc_alignedN(allocator, size, alignment, pool) (allocator)->malloc_aligned_fn((allocator)->user_data, size, alignment, pool)
+#define cgpu_realloc(allocator, ptr, size) (allocator)->realloc_fn((allocator)->user_data, ptr, size, 0)
 #define cgpu_calloc(allocator, count, size) (allocator)->calloc_fn((allocator)->user_data, count, size, 0)
 #define cgpu_callocN(allocator, count, size, pool) (allocator)->calloc_fn((allocator)->user_data, count, size, pool)
 #define cgpu_calloc_aligned(allocator, count, size, alignment) (allocator)->calloc_aligned_fn((allocator)->user_data, count, size, alignment, 0)
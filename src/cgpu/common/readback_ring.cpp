@@ -0,0 +1,307 @@
+#include "cgpu/api.h"
+#include "common_utils.h"
+#include <deque>
+#include <vector>
+
+class CGPUReadbackRingImpl : public CGPUReadbackRing
+{
+public:
+    static constexpr uint64_t kDefaultPageSize = 1024 * 1024;
+    // Keeps every copy naturally aligned for host reads of its contents
+    static constexpr uint64_t kCopyAlignment = 16;
+    // A page is refilled from the start once every ticket written to it has been released
+    struct Page
+    {
+        CGPUBufferId buffer;
+        uint64_t size;
+        uint64_t used;
+        uint32_t live_tickets;
+        bool dedicated;
+    };
+    struct Ticket
+    {
+        uint32_t page;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t frame;
+        CGPUProcReadbackCallback callback;
+        void* user_data;
+        bool ready;
+        bool released;
+    };
+    struct InFlightFrame
+    {
+        uint64_t frame;
+        CGPUFenceId fence;
+    };
+
+    CGPUReadbackRingImpl(CGPUDeviceId device, const CGPUReadbackRingDescriptor* desc)
+        : page_size(desc->page_size ? desc->page_size : kDefaultPageSize)
+    {
+        this->device = device;
+        this->pending_count = 0;
+    }
+    ~CGPUReadbackRingImpl()
+    {
+        for (auto&& frame : in_flight_frames)
+        {
+            if (frame.fence && cgpu_fence_query_status(frame.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                cgpu_wait_fences(1, &frame.fence);
+        }
+        for (auto&& page : pages)
+        {
+            if (page.buffer) cgpu_device_free_buffer(device, page.buffer);
+        }
+    }
+    Ticket* find_ticket(uint64_t ticket)
+    {
+        if (ticket < first_ticket || ticket >= first_ticket + tickets.size()) return nullptr;
+        Ticket* T = &tickets[(size_t)(ticket - first_ticket)];
+        return T->released ? nullptr : T;
+    }
+    CGPUBufferId create_page_buffer(uint64_t size)
+    {
+        CGPUBufferDescriptor buffer_desc = {};
+        buffer_desc.size = size;
+        buffer_desc.name = "ReadbackRing";
+        buffer_desc.memory_usage = CGPU_MEMORY_USAGE_GPU_TO_CPU;
+        buffer_desc.flags = CGPU_BUFFER_CREATION_USAGE_PERSISTENT_MAP;
+        return cgpu_device_create_buffer(device, &buffer_desc);
+    }
+    bool allocate(uint64_t size, uint32_t* page_index, uint64_t* offset)
+    {
+        if (size > page_size)
+        {
+            CGPUBufferId buffer = create_page_buffer(size);
+            if (!buffer) return false;
+            *page_index = acquire_page_slot(Page{ buffer, size, size, 0, true });
+            *offset = 0;
+            return true;
+        }
+        if (current_page < pages.size())
+        {
+            Page& page = pages[current_page];
+            const uint64_t aligned = cgpu_round_up(page.used, kCopyAlignment);
+            if (aligned + size <= page.size)
+            {
+                page.used = aligned + size;
+                *page_index = current_page;
+                *offset = aligned;
+                return true;
+            }
+        }
+        current_page = (uint32_t)pages.size();
+        for (uint32_t i = 0; i < pages.size(); i++)
+        {
+            if (pages[i].buffer && !pages[i].dedicated && pages[i].live_tickets == 0)
+            {
+                current_page = i;
+                break;
+            }
+        }
+        if (current_page == pages.size())
+        {
+            CGPUBufferId buffer = create_page_buffer(page_size);
+            if (!buffer) return false;
+            current_page = acquire_page_slot(Page{ buffer, page_size, 0, 0, false });
+        }
+        Page& page = pages[current_page];
+        page.used = size;
+        *page_index = current_page;
+        *offset = 0;
+        return true;
+    }
+    // Reuses the slot of a freed dedicated page so ticket page indices stay stable
+    uint32_t acquire_page_slot(const Page& page)
+    {
+        for (uint32_t i = 0; i < pages.size(); i++)
+        {
+            if (!pages[i].buffer)
+            {
+                pages[i] = page;
+                return i;
+            }
+        }
+        pages.push_back(page);
+        return (uint32_t)pages.size() - 1;
+    }
+    uint64_t read_buffer(CGPUCommandBufferId cmd, const CGPUBufferReadback* desc)
+    {
+        uint32_t page_index = 0;
+        uint64_t offset = 0;
+        if (!allocate(desc->size, &page_index, &offset)) return 0;
+        Page& page = pages[page_index];
+        page.live_tickets++;
+
+        CGPUBufferBarrier barriers[2] = {};
+        barriers[0].buffer = desc->buffer;
+        barriers[0].src_state = desc->src_state;
+        barriers[0].dst_state = CGPU_RESOURCE_STATE_COPY_SOURCE;
+        barriers[0].offset = desc->offset;
+        barriers[0].size = desc->size;
+        CGPUResourceBarrierDescriptor barrier_desc = {};
+        barrier_desc.buffer_barrier_count = 1;
+        barrier_desc.p_buffer_barriers = barriers;
+        cgpu_command_buffer_resource_barrier(cmd, &barrier_desc);
+
+        CGPUBufferToBufferTransfer copy = {};
+        copy.dst = page.buffer;
+        copy.dst_offset = offset;
+        copy.src = desc->buffer;
+        copy.src_offset = desc->offset;
+        copy.size = desc->size;
+        cgpu_command_buffer_transfer_buffer_to_buffer(cmd, &copy);
+
+        barriers[0].src_state = CGPU_RESOURCE_STATE_COPY_SOURCE;
+        barriers[0].dst_state = desc->src_state;
+        // The common state makes the copy visible to host reads
+        barriers[1].buffer = page.buffer;
+        barriers[1].src_state = CGPU_RESOURCE_STATE_COPY_DEST;
+        barriers[1].dst_state = CGPU_RESOURCE_STATE_COMMON;
+        barriers[1].offset = offset;
+        barriers[1].size = desc->size;
+        barrier_desc.buffer_barrier_count = 2;
+        cgpu_command_buffer_resource_barrier(cmd, &barrier_desc);
+
+        tickets.push_back(Ticket{ page_index, offset, desc->size, frame_index, desc->callback, desc->user_data, false, false });
+        pending_count++;
+        return first_ticket + tickets.size() - 1;
+    }
+    void advance_frame(CGPUFenceId fence)
+    {
+        in_flight_frames.push_back(InFlightFrame{ frame_index, fence });
+        frame_index++;
+        poll();
+    }
+    void poll()
+    {
+        while (!in_flight_frames.empty())
+        {
+            const InFlightFrame& oldest = in_flight_frames.front();
+            if (oldest.fence && cgpu_fence_query_status(oldest.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                break;
+            completed_frames = oldest.frame + 1;
+            in_flight_frames.pop_front();
+        }
+        // Tickets are ordered by frame, only the ones past ready_cursor can change state
+        for (; ready_cursor < first_ticket + tickets.size(); ready_cursor++)
+        {
+            Ticket& T = tickets[(size_t)(ready_cursor - first_ticket)];
+            if (T.frame >= completed_frames) break;
+            T.ready = true;
+            if (T.released)
+                free_ticket_memory(T);
+            else if (T.callback)
+            {
+                T.callback(T.user_data, map_ticket(T), T.size);
+                release_ticket(T);
+            }
+        }
+        while (!tickets.empty() && tickets.front().released && tickets.front().ready)
+        {
+            tickets.pop_front();
+            first_ticket++;
+        }
+    }
+    const void* map_ticket(const Ticket& T)
+    {
+        CGPUBufferId buffer = pages[T.page].buffer;
+        CGPUBufferRange range = { T.offset, T.size };
+        cgpu_buffer_invalidate(buffer, &range);
+        return buffer->info->cpu_mapped_address + T.offset;
+    }
+    void free_ticket_memory(Ticket& T)
+    {
+        Page& page = pages[T.page];
+        page.live_tickets--;
+        if (page.dedicated && page.live_tickets == 0)
+        {
+            cgpu_device_free_buffer(device, page.buffer);
+            page.buffer = nullptr;
+        }
+    }
+    // Memory of tickets still in flight is freed by poll once their frame retires
+    void release_ticket(Ticket& T)
+    {
+        T.released = true;
+        pending_count--;
+        if (T.ready) free_ticket_memory(T);
+    }
+    bool is_ready(uint64_t ticket)
+    {
+        Ticket* T = find_ticket(ticket);
+        return T && T->ready;
+    }
+    const void* map(uint64_t ticket)
+    {
+        Ticket* T = find_ticket(ticket);
+        if (!T || !T->ready) return nullptr;
+        return map_ticket(*T);
+    }
+    void release(uint64_t ticket)
+    {
+        Ticket* T = find_ticket(ticket);
+        if (!T) return;
+        cgpu_assert(!T->callback && "fatal: tickets with a callback are released by the readback ring!");
+        release_ticket(*T);
+    }
+protected:
+    const uint64_t page_size;
+    uint32_t current_page = 0;
+    uint64_t frame_index = 0;
+    uint64_t completed_frames = 0;
+    uint64_t first_ticket = 1;
+    uint64_t ready_cursor = 1;
+    std::vector<Page> pages;
+    std::deque<Ticket> tickets;
+    std::deque<InFlightFrame> in_flight_frames;
+};
+
+CGPUReadbackRingId CGPUUtil_CreateReadbackRing(CGPUDeviceId device, const CGPUReadbackRingDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    return cgpu_new_aligned<CGPUReadbackRingImpl>(allocator, device, desc);
+}
+
+uint64_t CGPUUtil_ReadbackRingReadBuffer(CGPUReadbackRingId ring, CGPUCommandBufferId cmd, const CGPUBufferReadback* desc)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    return R->read_buffer(cmd, desc);
+}
+
+void CGPUUtil_ReadbackRingAdvanceFrame(CGPUReadbackRingId ring, CGPUFenceId fence)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    R->advance_frame(fence);
+}
+
+void CGPUUtil_ReadbackRingPoll(CGPUReadbackRingId ring)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    R->poll();
+}
+
+bool CGPUUtil_ReadbackRingIsReady(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    return R->is_ready(ticket);
+}
+
+const void* CGPUUtil_ReadbackRingMap(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    return R->map(ticket);
+}
+
+void CGPUUtil_ReadbackRingRelease(CGPUReadbackRingId ring, uint64_t ticket)
+{
+    auto R = (CGPUReadbackRingImpl*)ring;
+    R->release(ticket);
+}
+
+void CGPUUtil_FreeReadbackRing(CGPUReadbackRingId ring)
+{
+    const CGPUAllocator* allocator = &ring->device->adapter->instance->allocator;
+    auto R = (CGPUReadbackRingImpl*)ring;
+    cgpu_delete(allocator, R);
+}
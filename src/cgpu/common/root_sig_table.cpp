@@ -240,6 +240,87 @@ void CGPUUtil_InitRSParamTables(CGPURootSignature* RS, const struct CGPURootSign
             dst->name = duplicate_string(dst->name, allocator);
         }
     }
+    // build name hash indices, kept at most half full
+    for (uint32_t i = 0; i < RS->table_count; i++)
+    {
+        CGPUParameterTable* table = &RS->p_tables[i];
+        uint32_t capacity = 2;
+        while (capacity < table->resources_count * 2) capacity <<= 1;
+        table->hash_index_mask = capacity - 1;
+        table->p_hash_index = (uint32_t*)cgpu_calloc(allocator, capacity, sizeof(uint32_t));
+        for (uint32_t j = 0; j < table->resources_count; j++)
+        {
+            const CGPUShaderResource* resource = &table->p_resources[j];
+            if (resource->name == CGPU_NULLPTR) continue;
+            uint32_t pos = (uint32_t)resource->name_hash & table->hash_index_mask;
+            while (table->p_hash_index[pos] != 0)
+            {
+                pos = (pos + 1) & table->hash_index_mask;
+            }
+            table->p_hash_index[pos] = j + 1;
+        }
+    }
+}
+
+uint32_t CGPUUtil_FindParamTableResource(const CGPUParameterTable* table, uint64_t name_hash)
+{
+    if (table->p_hash_index == CGPU_NULLPTR) return UINT32_MAX;
+    uint32_t pos = (uint32_t)name_hash & table->hash_index_mask;
+    while (table->p_hash_index[pos] != 0)
+    {
+        const uint32_t resource_index = table->p_hash_index[pos] - 1;
+        if (table->p_resources[resource_index].name_hash == name_hash)
+            return resource_index;
+        pos = (pos + 1) & table->hash_index_mask;
+    }
+    return UINT32_MAX;
+}
+
+uint32_t CGPUUtil_ResolveRSBinding(const CGPURootSignature* RS, const char* name)
+{
+    const uint64_t name_hash = cgpu_name_hash(name, strlen(name));
+    for (uint32_t i = 0; i < RS->table_count; i++)
+    {
+        const uint32_t resource_index = CGPUUtil_FindParamTableResource(&RS->p_tables[i], name_hash);
+        if (resource_index != UINT32_MAX)
+            return CGPU_BINDING_SLOT_MAKE(i, resource_index);
+    }
+    return CGPU_INVALID_BINDING_SLOT;
+}
+
+uint32_t CGPUUtil_ResolvePushConstant(const CGPURootSignature* RS, const char* name)
+{
+    if (name == CGPU_NULLPTR)
+        return RS->push_constant_count ? 0 : CGPU_INVALID_PUSH_CONSTANT_SLOT;
+    const uint64_t name_hash = cgpu_name_hash(name, strlen(name));
+    for (uint32_t i = 0; i < RS->push_constant_count; i++)
+    {
+        if (RS->p_push_constants[i].name_hash == name_hash)
+            return i;
+    }
+    // A single range is unambiguous, keep accepting any name for it
+    return RS->push_constant_count == 1 ? 0 : CGPU_INVALID_PUSH_CONSTANT_SLOT;
+}
+
+const CGPUShaderResource* CGPUUtil_FindDescriptorResource(const CGPUParameterTable* table, uint32_t table_index, const CGPUDescriptorData* data)
+{
+    if (data->slot != CGPU_INVALID_BINDING_SLOT)
+    {
+        cgpu_assert(CGPU_BINDING_SLOT_TABLE(data->slot) == table_index && "Binding slot is resolved for another set!");
+        cgpu_assert(CGPU_BINDING_SLOT_RESOURCE(data->slot) < table->resources_count && "Invalid binding slot!");
+        return table->p_resources + CGPU_BINDING_SLOT_RESOURCE(data->slot);
+    }
+    if (data->name != CGPU_NULLPTR)
+    {
+        const uint32_t resource_index = CGPUUtil_FindParamTableResource(table, cgpu_name_hash(data->name, strlen(data->name)));
+        return resource_index != UINT32_MAX ? table->p_resources + resource_index : CGPU_NULLPTR;
+    }
+    for (uint32_t i = 0; i < table->resources_count; i++)
+    {
+        if (table->p_resources[i].binding == data->binding)
+            return table->p_resources + i;
+    }
+    return CGPU_NULLPTR;
 }
 
 void CGPUUtil_FreeRSParamTables(CGPURootSignature* RS)
@@ -262,6 +343,10 @@ void CGPUUtil_FreeRSParamTables(CGPURootSignature* RS)
                 }
                 cgpu_free(allocator, param_table->p_resources);
             }
+            if (param_table->p_hash_index != CGPU_NULLPTR)
+            {
+                cgpu_free(allocator, param_table->p_hash_index);
+            }
         }
         cgpu_free(allocator, RS->p_tables);
     }
@@ -0,0 +1,418 @@
+#include "cgpu/api.h"
+#include "common_utils.h"
+#include <string.h>
+#include <vector>
+
+class CGPUUploadQueueImpl : public CGPUUploadQueue
+{
+public:
+    static constexpr uint64_t kDefaultPageSize = 4 * 1024 * 1024;
+    // Buffer copies have no offset requirement, dword alignment keeps the staging writes aligned
+    static constexpr uint64_t kBufferStagingAlignment = 4;
+    // Pages and command pools are reused once the timeline passes the token of the batch that last used them
+    struct StagingPage
+    {
+        CGPUBufferId buffer;
+        uint64_t used;
+        uint64_t last_token;
+        bool dedicated;
+    };
+    struct Batch
+    {
+        CGPUCommandPoolId pool;
+        CGPUCommandBufferId cmd;
+        uint64_t token;
+    };
+    template <typename Barrier>
+    struct PendingAcquire
+    {
+        Barrier barrier;
+        uint64_t token;
+    };
+
+    CGPUUploadQueueImpl(CGPUDeviceId device, const CGPUUploadQueueDescriptor* desc)
+        : page_size(desc->page_size ? desc->page_size : kDefaultPageSize)
+        , consumer_queue(desc->consumer_queue)
+    {
+        this->device = device;
+        this->queue = desc->queue;
+        this->timeline = cgpu_device_create_timeline_semaphore(device, 0);
+        this->submitted_token = 0;
+        transfer_ownership = consumer_queue && consumer_queue->type != queue->type;
+    }
+    ~CGPUUploadQueueImpl()
+    {
+        if (recording) flush();
+        wait(submitted_token);
+        for (auto&& page : pages)
+        {
+            cgpu_device_free_buffer(device, page.buffer);
+        }
+        for (auto&& batch : batches)
+        {
+            cgpu_command_pool_free_command_buffer(batch.pool, batch.cmd);
+            cgpu_queue_free_command_pool(queue, batch.pool);
+        }
+        cgpu_device_free_timeline_semaphore(device, timeline);
+    }
+    uint64_t completed_token() const
+    {
+        return cgpu_timeline_semaphore_query_value(timeline);
+    }
+    CGPUCommandBufferId begin_batch()
+    {
+        if (recording) return batches[current_batch].cmd;
+        const uint64_t completed = completed_token();
+        current_batch = (uint32_t)batches.size();
+        for (uint32_t i = 0; i < batches.size(); i++)
+        {
+            if (batches[i].token <= completed)
+            {
+                current_batch = i;
+                cgpu_command_pool_reset(batches[i].pool);
+                break;
+            }
+        }
+        if (current_batch == batches.size())
+        {
+            CGPUCommandPoolDescriptor pool_desc = { "UploadQueue" };
+            CGPUCommandPoolId pool = cgpu_queue_create_command_pool(queue, &pool_desc);
+            if (!pool) return nullptr;
+            CGPUCommandBufferDescriptor cmd_desc = { false };
+            CGPUCommandBufferId cmd = cgpu_command_pool_create_command_buffer(pool, &cmd_desc);
+            if (!cmd)
+            {
+                cgpu_queue_free_command_pool(queue, pool);
+                return nullptr;
+            }
+            batches.push_back(Batch{ pool, cmd, 0 });
+        }
+        Batch& batch = batches[current_batch];
+        batch.token = submitted_token + 1;
+        cgpu_command_buffer_begin(batch.cmd);
+        recording = true;
+        return batch.cmd;
+    }
+    // Buffer to texture copies need offsets on a multiple of both 4 and the texel block size
+    static uint64_t texture_staging_alignment(ECGPUTextureFormat format)
+    {
+        const uint64_t block_size = cgpu_max(FormatUtil_BitSizeOfBlock(format) / 8, 1u);
+        uint64_t a = block_size, b = 4;
+        while (b)
+        {
+            const uint64_t r = a % b;
+            a = b;
+            b = r;
+        }
+        return block_size / a * 4;
+    }
+    // Returns the staging buffer and writes the offset of size bytes reserved for the pending batch
+    CGPUBufferId allocate_staging(uint64_t size, uint64_t alignment, uint64_t* offset)
+    {
+        const uint64_t token = submitted_token + 1;
+        if (size > page_size)
+        {
+            CGPUBufferId buffer = create_staging_buffer(size);
+            if (!buffer) return nullptr;
+            pages.push_back(StagingPage{ buffer, size, token, true });
+            *offset = 0;
+            return buffer;
+        }
+        if (current_page < pages.size())
+        {
+            StagingPage& page = pages[current_page];
+            const uint64_t aligned = cgpu_round_up(page.used, alignment);
+            if (aligned + size <= page_size)
+            {
+                page.used = aligned + size;
+                page.last_token = token;
+                *offset = aligned;
+                return page.buffer;
+            }
+        }
+        const uint64_t completed = completed_token();
+        current_page = (uint32_t)pages.size();
+        for (uint32_t i = 0; i < pages.size();)
+        {
+            StagingPage& page = pages[i];
+            if (page.last_token > completed || page.last_token == token)
+            {
+                i++;
+                continue;
+            }
+            if (page.dedicated)
+            {
+                cgpu_device_free_buffer(device, page.buffer);
+                pages[i] = pages.back();
+                pages.pop_back();
+                current_page = (uint32_t)pages.size();
+                continue;
+            }
+            current_page = i;
+            break;
+        }
+        if (current_page == pages.size())
+        {
+            CGPUBufferId buffer = create_staging_buffer(page_size);
+            if (!buffer) return nullptr;
+            pages.push_back(StagingPage{ buffer, 0, 0, false });
+        }
+        StagingPage& page = pages[current_page];
+        page.used = size;
+        page.last_token = token;
+        *offset = 0;
+        return page.buffer;
+    }
+    CGPUBufferId create_staging_buffer(uint64_t size)
+    {
+        CGPUBufferDescriptor buffer_desc = {};
+        buffer_desc.size = size;
+        buffer_desc.name = "UploadQueueStaging";
+        buffer_desc.memory_usage = CGPU_MEMORY_USAGE_CPU_TO_GPU;
+        buffer_desc.flags = CGPU_BUFFER_CREATION_USAGE_PERSISTENT_MAP;
+        return cgpu_device_create_buffer(device, &buffer_desc);
+    }
+    uint64_t upload_buffer(const CGPUBufferUpload* desc)
+    {
+        CGPUCommandBufferId cmd = begin_batch();
+        uint64_t staging_offset = 0;
+        CGPUBufferId staging = cmd ? allocate_staging(desc->size, kBufferStagingAlignment, &staging_offset) : nullptr;
+        if (!staging) return CGPU_INVALID_UPLOAD_TOKEN;
+        memcpy(staging->info->cpu_mapped_address + staging_offset, desc->data, desc->size);
+
+        CGPUBufferBarrier barrier = {};
+        barrier.buffer = desc->buffer;
+        barrier.src_state = CGPU_RESOURCE_STATE_UNDEFINED;
+        barrier.dst_state = CGPU_RESOURCE_STATE_COPY_DEST;
+        barrier.offset = desc->offset;
+        barrier.size = desc->size;
+        CGPUResourceBarrierDescriptor barrier_desc = {};
+        barrier_desc.buffer_barrier_count = 1;
+        barrier_desc.p_buffer_barriers = &barrier;
+        cgpu_command_buffer_resource_barrier(cmd, &barrier_desc);
+
+        CGPUBufferToBufferTransfer copy = {};
+        copy.dst = desc->buffer;
+        copy.dst_offset = desc->offset;
+        copy.src = staging;
+        copy.src_offset = staging_offset;
+        copy.size = desc->size;
+        cgpu_command_buffer_transfer_buffer_to_buffer(cmd, &copy);
+
+        barrier.src_state = CGPU_RESOURCE_STATE_COPY_DEST;
+        barrier.dst_state = desc->dst_state;
+        if (transfer_ownership)
+        {
+            barrier.queue_release = 1;
+            barrier.queue_type = consumer_queue->type;
+            release_buffers.push_back(barrier);
+            barrier.queue_release = 0;
+            barrier.queue_acquire = 1;
+            barrier.queue_type = queue->type;
+            acquire_buffers.push_back(PendingAcquire<CGPUBufferBarrier>{ barrier, submitted_token + 1 });
+        }
+        else
+            final_buffers.push_back(barrier);
+        return submitted_token + 1;
+    }
+    uint64_t upload_texture(const CGPUTextureUpload* desc)
+    {
+        CGPUCommandBufferId cmd = begin_batch();
+        uint64_t staging_offset = 0;
+        const uint64_t alignment = texture_staging_alignment(desc->texture->info->format);
+        CGPUBufferId staging = cmd ? allocate_staging(desc->size, alignment, &staging_offset) : nullptr;
+        if (!staging) return CGPU_INVALID_UPLOAD_TOKEN;
+        memcpy(staging->info->cpu_mapped_address + staging_offset, desc->data, desc->size);
+
+        CGPUTextureBarrier barrier = {};
+        barrier.texture = desc->texture;
+        barrier.src_state = CGPU_RESOURCE_STATE_UNDEFINED;
+        barrier.dst_state = CGPU_RESOURCE_STATE_COPY_DEST;
+        barrier.subresource_barrier = 1;
+        barrier.mip_level = (uint8_t)desc->mip_level;
+        barrier.array_layer = (uint16_t)desc->array_layer;
+        CGPUResourceBarrierDescriptor barrier_desc = {};
+        barrier_desc.texture_barrier_count = 1;
+        barrier_desc.p_texture_barriers = &barrier;
+        cgpu_command_buffer_resource_barrier(cmd, &barrier_desc);
+
+        CGPUBufferToTextureTransfer copy = {};
+        copy.dst = desc->texture;
+        copy.dst_subresource.aspects = desc->texture->info->aspect_mask;
+        copy.dst_subresource.mip_level = desc->mip_level;
+        copy.dst_subresource.base_array_layer = desc->array_layer;
+        copy.dst_subresource.layer_count = 1;
+        copy.src = staging;
+        copy.src_offset = staging_offset;
+        cgpu_command_buffer_transfer_buffer_to_texture(cmd, &copy);
+
+        barrier.src_state = CGPU_RESOURCE_STATE_COPY_DEST;
+        barrier.dst_state = desc->dst_state;
+        if (transfer_ownership)
+        {
+            barrier.queue_release = 1;
+            barrier.queue_type = consumer_queue->type;
+            release_textures.push_back(barrier);
+            barrier.queue_release = 0;
+            barrier.queue_acquire = 1;
+            barrier.queue_type = queue->type;
+            acquire_textures.push_back(PendingAcquire<CGPUTextureBarrier>{ barrier, submitted_token + 1 });
+        }
+        else
+            final_textures.push_back(barrier);
+        return submitted_token + 1;
+    }
+    uint64_t flush()
+    {
+        if (!recording) return submitted_token;
+        Batch& batch = batches[current_batch];
+        // Final transitions, or the release half of the ownership transfer, all in one barrier call
+        CGPUResourceBarrierDescriptor barrier_desc = {};
+        barrier_desc.buffer_barrier_count = (uint32_t)(transfer_ownership ? release_buffers.size() : final_buffers.size());
+        barrier_desc.p_buffer_barriers = transfer_ownership ? release_buffers.data() : final_buffers.data();
+        barrier_desc.texture_barrier_count = (uint32_t)(transfer_ownership ? release_textures.size() : final_textures.size());
+        barrier_desc.p_texture_barriers = transfer_ownership ? release_textures.data() : final_textures.data();
+        if (barrier_desc.buffer_barrier_count + barrier_desc.texture_barrier_count)
+            cgpu_command_buffer_resource_barrier(batch.cmd, &barrier_desc);
+        release_buffers.clear();
+        release_textures.clear();
+        final_buffers.clear();
+        final_textures.clear();
+        cgpu_command_buffer_end(batch.cmd);
+
+        const uint64_t token = submitted_token + 1;
+        CGPUQueueSubmitDescriptor submit_desc = {};
+        submit_desc.cmd_count = 1;
+        submit_desc.p_cmds = &batch.cmd;
+        submit_desc.signal_timeline_count = 1;
+        submit_desc.p_signal_timelines = &timeline;
+        submit_desc.p_signal_timeline_values = &token;
+        cgpu_queue_submit(queue, &submit_desc);
+        batch.token = token;
+        submitted_token = token;
+        recording = false;
+        // The next batch starts a fresh page, so a page never mixes tokens of unflushed batches
+        current_page = (uint32_t)pages.size();
+        return token;
+    }
+    bool is_complete(uint64_t token) const
+    {
+        return token != CGPU_INVALID_UPLOAD_TOKEN && completed_token() >= token;
+    }
+    void wait(uint64_t token)
+    {
+        cgpu_assert(token != CGPU_INVALID_UPLOAD_TOKEN && "fatal: waiting on a failed upload!");
+        if (token == CGPU_INVALID_UPLOAD_TOKEN) return;
+        if (recording && token > submitted_token) flush();
+        cgpu_assert(token <= submitted_token && "fatal: waiting on an upload token that was never issued!");
+        if (token == 0 || is_complete(token)) return;
+        cgpu_wait_timeline_semaphores(1, &timeline, &token, UINT64_MAX);
+    }
+    void record_acquire_barriers(CGPUCommandBufferId cmd, uint64_t token)
+    {
+        // Acquires of batches that are not flushed yet stay queued until a later call
+        acquire_scratch_buffers.clear();
+        acquire_scratch_textures.clear();
+        for (size_t i = 0; i < acquire_buffers.size();)
+        {
+            if (acquire_buffers[i].token <= token && acquire_buffers[i].token <= submitted_token)
+            {
+                acquire_scratch_buffers.push_back(acquire_buffers[i].barrier);
+                acquire_buffers[i] = acquire_buffers.back();
+                acquire_buffers.pop_back();
+            }
+            else
+                i++;
+        }
+        for (size_t i = 0; i < acquire_textures.size();)
+        {
+            if (acquire_textures[i].token <= token && acquire_textures[i].token <= submitted_token)
+            {
+                acquire_scratch_textures.push_back(acquire_textures[i].barrier);
+                acquire_textures[i] = acquire_textures.back();
+                acquire_textures.pop_back();
+            }
+            else
+                i++;
+        }
+        if (acquire_scratch_buffers.empty() && acquire_scratch_textures.empty()) return;
+        CGPUResourceBarrierDescriptor barrier_desc = {};
+        barrier_desc.buffer_barrier_count = (uint32_t)acquire_scratch_buffers.size();
+        barrier_desc.p_buffer_barriers = acquire_scratch_buffers.data();
+        barrier_desc.texture_barrier_count = (uint32_t)acquire_scratch_textures.size();
+        barrier_desc.p_texture_barriers = acquire_scratch_textures.data();
+        cgpu_command_buffer_resource_barrier(cmd, &barrier_desc);
+    }
+protected:
+    const uint64_t page_size;
+    const CGPUQueueId consumer_queue;
+    bool transfer_ownership = false;
+    bool recording = false;
+    uint32_t current_batch = 0;
+    uint32_t current_page = 0;
+    std::vector<StagingPage> pages;
+    std::vector<Batch> batches;
+    std::vector<CGPUBufferBarrier> final_buffers;
+    std::vector<CGPUTextureBarrier> final_textures;
+    std::vector<CGPUBufferBarrier> release_buffers;
+    std::vector<CGPUTextureBarrier> release_textures;
+    std::vector<PendingAcquire<CGPUBufferBarrier>> acquire_buffers;
+    std::vector<PendingAcquire<CGPUTextureBarrier>> acquire_textures;
+    std::vector<CGPUBufferBarrier> acquire_scratch_buffers;
+    std::vector<CGPUTextureBarrier> acquire_scratch_textures;
+};
+
+CGPUUploadQueueId CGPUUtil_CreateUploadQueue(CGPUDeviceId device, const CGPUUploadQueueDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    auto Q = cgpu_new_aligned<CGPUUploadQueueImpl>(allocator, device, desc);
+    if (Q->timeline == CGPU_NULLPTR)
+    {
+        cgpu_delete(allocator, Q);
+        return CGPU_NULLPTR;
+    }
+    return Q;
+}
+
+uint64_t CGPUUtil_UploadQueueUploadBuffer(CGPUUploadQueueId queue, const CGPUBufferUpload* desc)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    return Q->upload_buffer(desc);
+}
+
+uint64_t CGPUUtil_UploadQueueUploadTexture(CGPUUploadQueueId queue, const CGPUTextureUpload* desc)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    return Q->upload_texture(desc);
+}
+
+uint64_t CGPUUtil_UploadQueueFlush(CGPUUploadQueueId queue)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    return Q->flush();
+}
+
+bool CGPUUtil_UploadQueueIsComplete(CGPUUploadQueueId queue, uint64_t token)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    return Q->is_complete(token);
+}
+
+void CGPUUtil_UploadQueueWait(CGPUUploadQueueId queue, uint64_t token)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    Q->wait(token);
+}
+
+void CGPUUtil_UploadQueueRecordAcquireBarriers(CGPUUploadQueueId queue, CGPUCommandBufferId cmd, uint64_t token)
+{
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    Q->record_acquire_barriers(cmd, token);
+}
+
+void CGPUUtil_FreeUploadQueue(CGPUUploadQueueId queue)
+{
+    const CGPUAllocator* allocator = &queue->device->adapter->instance->allocator;
+    auto Q = (CGPUUploadQueueImpl*)queue;
+    cgpu_delete(allocator, Q);
+}
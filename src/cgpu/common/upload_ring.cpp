@@ -0,0 +1,159 @@
+#include "cgpu/api.h"
+#include "common_utils.h"
+#include <deque>
+#include <vector>
+
+class CGPUUploadRingImpl : public CGPUUploadRing
+{
+public:
+    static constexpr uint64_t kDefaultCapacity = 4 * 1024 * 1024;
+    // Positions are monotonic byte counters, the offset in the buffer is position % capacity
+    struct InFlightFrame
+    {
+        uint64_t frame;
+        CGPUFenceId fence;
+        uint64_t head;
+        uint32_t generation;
+    };
+    struct RetiredBuffer
+    {
+        CGPUBufferId buffer;
+        uint64_t last_frame;
+    };
+
+    CGPUUploadRingImpl(CGPUDeviceId device, const CGPUUploadRingDescriptor* desc)
+    {
+        this->device = device;
+        this->buffer = nullptr;
+        this->capacity = 0;
+        this->used_bytes = 0;
+        create_buffer(desc->size ? desc->size : kDefaultCapacity);
+    }
+    ~CGPUUploadRingImpl()
+    {
+        for (auto&& frame : in_flight_frames)
+        {
+            if (frame.fence && cgpu_fence_query_status(frame.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                cgpu_wait_fences(1, &frame.fence);
+        }
+        for (auto&& retired : retired_buffers)
+        {
+            cgpu_device_free_buffer(device, retired.buffer);
+        }
+        if (buffer) cgpu_device_free_buffer(device, buffer);
+    }
+    bool create_buffer(uint64_t size)
+    {
+        CGPUBufferDescriptor buffer_desc = {};
+        buffer_desc.size = size;
+        buffer_desc.name = "UploadRing";
+        buffer_desc.descriptors = CGPU_RESOURCE_TYPE_UNIFORM_BUFFER | CGPU_RESOURCE_TYPE_VERTEX_BUFFER | CGPU_RESOURCE_TYPE_INDEX_BUFFER;
+        buffer_desc.memory_usage = CGPU_MEMORY_USAGE_CPU_TO_GPU;
+        buffer_desc.flags = CGPU_BUFFER_CREATION_USAGE_PERSISTENT_MAP;
+        CGPUBufferId new_buffer = cgpu_device_create_buffer(device, &buffer_desc);
+        if (new_buffer == CGPU_NULLPTR) return false;
+        buffer = new_buffer;
+        capacity = size;
+        head = 0;
+        tail = 0;
+        generation++;
+        return true;
+    }
+    bool try_allocate(uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation)
+    {
+        if (!buffer) return false;
+        uint64_t offset = cgpu_round_up(head % capacity, alignment);
+        uint64_t start = head - head % capacity + offset;
+        if (offset + size > capacity)
+        {
+            // Never split an allocation, skip the rest of the buffer instead
+            start = (head / capacity + 1) * capacity;
+            offset = 0;
+        }
+        if (start + size - tail > capacity) return false;
+        head = start + size;
+        used_bytes = head - tail;
+        allocation->buffer = buffer;
+        allocation->offset = offset;
+        allocation->size = size;
+        allocation->cpu_address = (uint8_t*)buffer->info->cpu_mapped_address + offset;
+        return true;
+    }
+    bool allocate(uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation)
+    {
+        alignment = alignment ? alignment : 1;
+        cgpu_assert((alignment & (alignment - 1)) == 0 && "fatal: upload ring alignment must be a power of two!");
+        if (try_allocate(size, alignment, allocation)) return true;
+        retire_frames();
+        if (try_allocate(size, alignment, allocation)) return true;
+        // The current buffer may still be read by in-flight frames and by the frame being recorded
+        if (buffer) retired_buffers.push_back(RetiredBuffer{ buffer, frame_index });
+        buffer = nullptr;
+        if (!create_buffer(cgpu_max(capacity * 2, cgpu_round_up(size + alignment, kDefaultCapacity)))) return false;
+        return try_allocate(size, alignment, allocation);
+    }
+    void advance_frame(CGPUFenceId fence)
+    {
+        in_flight_frames.push_back(InFlightFrame{ frame_index, fence, head, generation });
+        frame_index++;
+        retire_frames();
+    }
+    void retire_frames()
+    {
+        while (!in_flight_frames.empty())
+        {
+            const InFlightFrame& oldest = in_flight_frames.front();
+            // A null or unsubmitted fence stands for a frame whose work is already done
+            if (oldest.fence && cgpu_fence_query_status(oldest.fence) == CGPU_FENCE_STATUS_INCOMPLETE)
+                break;
+            completed_frames = oldest.frame + 1;
+            if (oldest.generation == generation) tail = oldest.head;
+            in_flight_frames.pop_front();
+        }
+        for (size_t i = 0; i < retired_buffers.size();)
+        {
+            if (retired_buffers[i].last_frame < completed_frames)
+            {
+                cgpu_device_free_buffer(device, retired_buffers[i].buffer);
+                retired_buffers[i] = retired_buffers.back();
+                retired_buffers.pop_back();
+            }
+            else
+                i++;
+        }
+        used_bytes = head - tail;
+    }
+protected:
+    uint64_t head = 0;
+    uint64_t tail = 0;
+    uint32_t generation = 0;
+    uint64_t frame_index = 0;
+    uint64_t completed_frames = 0;
+    std::deque<InFlightFrame> in_flight_frames;
+    std::vector<RetiredBuffer> retired_buffers;
+};
+
+CGPUUploadRingId CGPUUtil_CreateUploadRing(CGPUDeviceId device, const CGPUUploadRingDescriptor* desc)
+{
+    const CGPUAllocator* allocator = &device->adapter->instance->allocator;
+    return cgpu_new_aligned<CGPUUploadRingImpl>(allocator, device, desc);
+}
+
+bool CGPUUtil_UploadRingAllocate(CGPUUploadRingId ring, uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation)
+{
+    auto R = (CGPUUploadRingImpl*)ring;
+    return R->allocate(size, alignment, allocation);
+}
+
+void CGPUUtil_UploadRingAdvanceFrame(CGPUUploadRingId ring, CGPUFenceId fence)
+{
+    auto R = (CGPUUploadRingImpl*)ring;
+    R->advance_frame(fence);
+}
+
+void CGPUUtil_FreeUploadRing(CGPUUploadRingId ring)
+{
+    const CGPUAllocator* allocator = &ring->device->adapter->instance->allocator;
+    auto R = (CGPUUploadRingImpl*)ring;
+    cgpu_delete(allocator, R);
+}
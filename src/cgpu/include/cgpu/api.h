@@ -22,6 +22,14 @@ CGPU_EXTERN_C_BEGIN
 
 #define CGPU_SHADER_STAGE_COUNT 6
 
+#define CGPU_INVALID_BINDING_SLOT 0
+
+#define CGPU_INVALID_BINDLESS_INDEX 4294967295
+
+#define CGPU_INVALID_PUSH_CONSTANT_SLOT 4294967295
+
+#define CGPU_INVALID_UPLOAD_TOKEN 0xFFFFFFFFFFFFFFFF
+
 
 #define DEFINE_CGPU_OBJECT(name) typedef const struct name* name##Id;
 
@@ -452,6 +460,15 @@ typedef enum ECGPUQueryType
 
 } ECGPUQueryType;
 
+typedef enum ECGPURenderPassContents
+{
+    CGPU_RENDER_PASS_CONTENTS_INLINE_COMMANDS, /** ( 0)                                */
+    CGPU_RENDER_PASS_CONTENTS_SECONDARY_COMMAND_BUFFERS, /** ( 1)                                */
+
+    CGPU_RENDER_PASS_CONTENTS_COUNT
+
+} ECGPURenderPassContents;
+
 typedef enum ECGPUMemoryUsage
 {
     CGPU_MEMORY_USAGE_UNKNOWN,                /** ( 0)                                */
@@ -838,6 +855,7 @@ DEFINE_CGPU_OBJECT(CGPUDevice)
 DEFINE_CGPU_OBJECT(CGPUQueue)
 DEFINE_CGPU_OBJECT(CGPUSemaphore)
 DEFINE_CGPU_OBJECT(CGPUFence)
+DEFINE_CGPU_OBJECT(CGPUTimelineSemaphore)
 DEFINE_CGPU_OBJECT(CGPUCommandPool)
 DEFINE_CGPU_OBJECT(CGPUCommandBuffer)
 DEFINE_CGPU_OBJECT(CGPUQueryPool)
@@ -854,6 +872,12 @@ DEFINE_CGPU_OBJECT(CGPUShaderLibrary)
 DEFINE_CGPU_OBJECT(CGPURootSignaturePool)
 DEFINE_CGPU_OBJECT(CGPURootSignature)
 DEFINE_CGPU_OBJECT(CGPUDescriptorSet)
+DEFINE_CGPU_OBJECT(CGPUDescriptorArena)
+DEFINE_CGPU_OBJECT(CGPUDescriptorSetCache)
+DEFINE_CGPU_OBJECT(CGPUCommandRing)
+DEFINE_CGPU_OBJECT(CGPUUploadRing)
+DEFINE_CGPU_OBJECT(CGPUUploadQueue)
+DEFINE_CGPU_OBJECT(CGPUReadbackRing)
 DEFINE_CGPU_OBJECT(CGPUShaderReflection)
 DEFINE_CGPU_OBJECT(CGPUCompiledShader)
 DEFINE_CGPU_OBJECT(CGPULinkedShader)
@@ -874,14 +898,18 @@ typedef struct CGPUSurfacesProcTable CGPUSurfacesProcTable;
 typedef struct CGPURuntimeTable CGPURuntimeTable;
 typedef struct CGPUAdapterDetail CGPUAdapterDetail;
 typedef struct CGPUDeviceDescriptor CGPUDeviceDescriptor;
+typedef struct CGPUDescriptorPoolStats CGPUDescriptorPoolStats;
+typedef struct CGPUCommandBufferStatistics CGPUCommandBufferStatistics;
 typedef struct CGPURootSignaturePoolDescriptor CGPURootSignaturePoolDescriptor;
 typedef struct CGPURootSignatureDescriptor CGPURootSignatureDescriptor;
 typedef struct CGPUDescriptorSetDescriptor CGPUDescriptorSetDescriptor;
+typedef struct CGPUDescriptorArenaDescriptor CGPUDescriptorArenaDescriptor;
 typedef struct CGPUDescriptorData CGPUDescriptorData;
 typedef struct CGPUComputePipelineDescriptor CGPUComputePipelineDescriptor;
 typedef struct CGPURenderPipelineDescriptor CGPURenderPipelineDescriptor;
 typedef struct CGPUQueryPoolDescriptor CGPUQueryPoolDescriptor;
 typedef struct CGPUMemoryPoolDescriptor CGPUMemoryPoolDescriptor;
+typedef struct CGPUMemoryPoolStatistics CGPUMemoryPoolStatistics;
 typedef struct CGPUQueueSubmitDescriptor CGPUQueueSubmitDescriptor;
 typedef struct CGPUQueuePresentDescriptor CGPUQueuePresentDescriptor;
 typedef struct CGPUTiledTextureRegions CGPUTiledTextureRegions;
@@ -890,6 +918,7 @@ typedef struct CGPURenderPassDescriptor CGPURenderPassDescriptor;
 typedef struct CGPUFramebufferDescriptor CGPUFramebufferDescriptor;
 typedef struct CGPUCommandPoolDescriptor CGPUCommandPoolDescriptor;
 typedef struct CGPUCommandBufferDescriptor CGPUCommandBufferDescriptor;
+typedef struct CGPUCommandBufferInheritanceInfo CGPUCommandBufferInheritanceInfo;
 typedef struct CGPUShaderLibraryDescriptor CGPUShaderLibraryDescriptor;
 typedef struct CGPUBufferDescriptor CGPUBufferDescriptor;
 typedef struct CGPUBufferRange CGPUBufferRange;
@@ -916,6 +945,7 @@ typedef struct CGPUStateBufferDescriptor CGPUStateBufferDescriptor;
 typedef struct CGPUVertexLayout CGPUVertexLayout;
 
 typedef void (*CGPUProcLogCallback)(void* user_data, ECGPULogSeverity severity, const char* fmt, ... );
+typedef void (*CGPUProcReadbackCallback)(void* user_data, const void* data, uint64_t size);
 typedef void* (*CGPUProcMalloc)(void* user_data, size_t size, const void* pool);
 typedef void* (*CGPUProcRealloc)(void* user_data, void* ptr, size_t size, const void* pool);
 typedef void* (*CGPUProcCalloc)(void* user_data, size_t count, size_t size, const void* pool);
@@ -936,6 +966,8 @@ typedef const CGPUAdapterDetail* (*CGPUProcQueryAdapterDetail)(CGPUAdapterId ada
 typedef uint32_t (*CGPUProcQueryQueueCount)(CGPUAdapterId adapter, ECGPUQueueType type);
 typedef CGPUDeviceId (*CGPUProcCreateDevice)(CGPUAdapterId adapter, const CGPUDeviceDescriptor* desc);
 typedef void (*CGPUProcFreeDevice)(CGPUAdapterId adapter, CGPUDeviceId device);
+typedef size_t (*CGPUProcGetPipelineCacheData)(CGPUDeviceId device, size_t size, void* data);
+typedef void (*CGPUProcQueryDescriptorPoolStats)(CGPUDeviceId device, CGPUDescriptorPoolStats* stats);
 typedef void (*CGPUProcQueryVideoMemoryInfo)(CGPUDeviceId device, uint64_t* total, uint64_t* used);
 typedef void (*CGPUProcQuerySharedMemoryInfo)(CGPUDeviceId device, uint64_t* total, uint64_t* used);
 typedef CGPUFenceId (*CGPUProcCreateFence)(CGPUDeviceId device);
@@ -945,6 +977,11 @@ typedef ECGPUFenceStatus (*CGPUProcQueryFenceStatus)(CGPUFenceId fence);
 typedef void (*CGPUProcFreeFence)(CGPUDeviceId device, CGPUFenceId fence);
 typedef CGPUSemaphoreId (*CGPUProcCreateSemaphore)(CGPUDeviceId device);
 typedef void (*CGPUProcFreeSemaphore)(CGPUDeviceId device, CGPUSemaphoreId semaphore);
+typedef CGPUTimelineSemaphoreId (*CGPUProcCreateTimelineSemaphore)(CGPUDeviceId device, uint64_t initial_value);
+typedef void (*CGPUProcFreeTimelineSemaphore)(CGPUDeviceId device, CGPUTimelineSemaphoreId semaphore);
+typedef void (*CGPUProcSignalTimelineSemaphore)(CGPUTimelineSemaphoreId semaphore, uint64_t value);
+typedef bool (*CGPUProcWaitTimelineSemaphores)(uint32_t semaphore_count, const CGPUTimelineSemaphoreId* p_semaphores, const uint64_t* p_values, uint64_t timeout_ns);
+typedef uint64_t (*CGPUProcQueryTimelineSemaphoreValue)(CGPUTimelineSemaphoreId semaphore);
 typedef CGPURootSignaturePoolId (*CGPUProcCreateRootSignaturePool)(CGPUDeviceId device, const CGPURootSignaturePoolDescriptor* desc);
 typedef void (*CGPUProcFreeRootSignaturePool)(CGPUDeviceId device, CGPURootSignaturePoolId pool);
 typedef CGPURootSignatureId (*CGPUProcCreateRootSignature)(CGPUDeviceId device, const CGPURootSignatureDescriptor* desc);
@@ -952,6 +989,15 @@ typedef void (*CGPUProcFreeRootSignature)(CGPUDeviceId device, CGPURootSignature
 typedef CGPUDescriptorSetId (*CGPUProcCreateDescriptorSet)(CGPUDeviceId device, const CGPUDescriptorSetDescriptor* desc);
 typedef void (*CGPUProcUpdateDescriptorSet)(CGPUDescriptorSetId set, uint32_t data_count, const CGPUDescriptorData* p_datas);
 typedef void (*CGPUProcFreeDescriptorSet)(CGPUDeviceId device, CGPUDescriptorSetId set);
+typedef CGPUDescriptorArenaId (*CGPUProcCreateDescriptorArena)(CGPUDeviceId device, const CGPUDescriptorArenaDescriptor* desc);
+typedef CGPUDescriptorSetId (*CGPUProcDescriptorArenaAllocateSet)(CGPUDescriptorArenaId arena, const CGPUDescriptorSetDescriptor* desc);
+typedef void (*CGPUProcResetDescriptorArena)(CGPUDescriptorArenaId arena);
+typedef void (*CGPUProcFreeDescriptorArena)(CGPUDeviceId device, CGPUDescriptorArenaId arena);
+typedef uint32_t (*CGPUProcRegisterBindlessTextureView)(CGPUDeviceId device, CGPUTextureViewId view);
+typedef uint32_t (*CGPUProcRegisterBindlessBuffer)(CGPUDeviceId device, CGPUBufferId buffer);
+typedef void (*CGPUProcUnregisterBindlessTextureView)(CGPUDeviceId device, uint32_t index);
+typedef void (*CGPUProcUnregisterBindlessBuffer)(CGPUDeviceId device, uint32_t index);
+typedef void (*CGPUProcAdvanceBindlessFrame)(CGPUDeviceId device, CGPUFenceId fence);
 typedef CGPUComputePipelineId (*CGPUProcCreateComputePipeline)(CGPUDeviceId device, const CGPUComputePipelineDescriptor* desc);
 typedef void (*CGPUProcFreeComputePipeline)(CGPUDeviceId device, CGPUComputePipelineId pipeline);
 typedef CGPURenderPipelineId (*CGPUProcCreateRenderPipeline)(CGPUDeviceId device, const CGPURenderPipelineDescriptor* desc);
@@ -960,8 +1006,10 @@ typedef CGPUQueryPoolId (*CGPUProcCreateQueryPool)(CGPUDeviceId device, const CG
 typedef void (*CGPUProcFreeQueryPool)(CGPUDeviceId device, CGPUQueryPoolId pool);
 typedef CGPUMemoryPoolId (*CGPUProcCreateMemoryPool)(CGPUDeviceId device, const CGPUMemoryPoolDescriptor* desc);
 typedef void (*CGPUProcFreeMemoryPool)(CGPUDeviceId device, CGPUMemoryPoolId pool);
+typedef void (*CGPUProcQueryMemoryPoolStatistics)(CGPUMemoryPoolId pool, CGPUMemoryPoolStatistics* stats);
 typedef CGPUQueueId (*CGPUProcGetQueue)(CGPUDeviceId device, ECGPUQueueType type, uint32_t index);
 typedef ECGPUSubmitError (*CGPUProcSubmitQueue)(CGPUQueueId queue, const CGPUQueueSubmitDescriptor* desc);
+typedef ECGPUSubmitError (*CGPUProcSubmitQueueBatches)(CGPUQueueId queue, uint32_t batch_count, const CGPUQueueSubmitDescriptor* p_descs);
 typedef ECGPUPresentError (*CGPUProcQueuePresent)(CGPUQueueId queue, const CGPUQueuePresentDescriptor* desc);
 typedef void (*CGPUProcWaitQueueIdle)(CGPUQueueId queue);
 typedef float (*CGPUProcQueueGetTimestampPeriodNS)(CGPUQueueId queue);
@@ -984,6 +1032,7 @@ typedef void (*CGPUProcFreeShaderLibrary)(CGPUDeviceId device, CGPUShaderLibrary
 typedef CGPUBufferId (*CGPUProcCreateBuffer)(CGPUDeviceId device, const CGPUBufferDescriptor* desc);
 typedef void (*CGPUProcMapBuffer)(CGPUBufferId buffer, const CGPUBufferRange* range);
 typedef void (*CGPUProcUnmapBuffer)(CGPUBufferId buffer);
+typedef void (*CGPUProcInvalidateBuffer)(CGPUBufferId buffer, const CGPUBufferRange* range);
 typedef void (*CGPUProcFreeBuffer)(CGPUDeviceId device, CGPUBufferId buffer);
 typedef CGPUSamplerId (*CGPUProcCreateSampler)(CGPUDeviceId device, const CGPUSamplerDescriptor* desc);
 typedef void (*CGPUProcFreeSampler)(CGPUDeviceId device, CGPUSamplerId sampler);
@@ -998,6 +1047,8 @@ typedef CGPUSwapChainId (*CGPUProcCreateSwapChain)(CGPUDeviceId device, const CG
 typedef ECGPUAcquireNextImageError (*CGPUProcAcquireNextImage)(CGPUSwapChainId swapchain, const CGPUAcquireNextDescriptor* desc, uint32_t* p_image_index);
 typedef void (*CGPUProcFreeSwapChain)(CGPUDeviceId device, CGPUSwapChainId swapchain);
 typedef void (*CGPUProcCmdBegin)(CGPUCommandBufferId cmd);
+typedef CGPURenderPassEncoderId (*CGPUProcCmdBeginSecondary)(CGPUCommandBufferId cmd, const CGPUCommandBufferInheritanceInfo* inheritance);
+typedef void (*CGPUProcCmdExecuteSecondaries)(CGPUCommandBufferId cmd, uint32_t count, const CGPUCommandBufferId* p_secondaries);
 typedef void (*CGPUProcCmdTransferBufferToBuffer)(CGPUCommandBufferId cmd, const CGPUBufferToBufferTransfer* desc);
 typedef void (*CGPUProcCmdTransferTextureToTexture)(CGPUCommandBufferId cmd, const CGPUTextureToTextureTransfer* desc);
 typedef void (*CGPUProcCmdTransferBufferToTexture)(CGPUCommandBufferId cmd, const CGPUBufferToTextureTransfer* desc);
@@ -1008,10 +1059,12 @@ typedef void (*CGPUProcCmdEndQuery)(CGPUCommandBufferId cmd, CGPUQueryPoolId poo
 typedef void (*CGPUProcCmdResetQueryPool)(CGPUCommandBufferId cmd, CGPUQueryPoolId pool, uint32_t start_query, uint32_t query_count);
 typedef void (*CGPUProcCmdResolveQuery)(CGPUCommandBufferId cmd, CGPUQueryPoolId pool, CGPUBufferId readback, uint32_t start_query, uint32_t query_count);
 typedef void (*CGPUProcCmdEnd)(CGPUCommandBufferId cmd);
+typedef void (*CGPUProcQueryCommandBufferStatistics)(CGPUCommandBufferId cmd, CGPUCommandBufferStatistics* stats);
 typedef CGPUComputePassEncoderId (*CGPUProcCmdBeginComputePass)(CGPUCommandBufferId cmd, const CGPUComputePassDescriptor* desc);
 typedef void (*CGPUProcComputeEncoderBindDescriptorSet)(CGPUComputePassEncoderId encoder, CGPUDescriptorSetId set, uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
 typedef void (*CGPUProcComputeEncoderBindPipeline)(CGPUComputePassEncoderId encoder, CGPUComputePipelineId pipeline);
 typedef void (*CGPUProcComputeEncoderDispatch)(CGPUComputePassEncoderId encoder, uint32_t x, uint32_t y, uint32_t z);
+typedef void (*CGPUProcComputeEncoderDispatchIndirect)(CGPUComputePassEncoderId encoder, CGPUBufferId buffer, uint64_t offset);
 typedef void (*CGPUProcCmdEndComputePass)(CGPUCommandBufferId cmd, CGPUComputePassEncoderId encoder);
 typedef CGPURenderPassEncoderId (*CGPUProcCmdBeginRenderPass)(CGPUCommandBufferId cmd, const CGPUBeginRenderPassInfo* begin_info);
 typedef void (*CGPUProcRenderEncoderSetShadingRate)(CGPURenderPassEncoderId encoder, ECGPUShadingRate shading_rate, ECGPUShadingRateCombiner post_rasterize_rate, ECGPUShadingRateCombiner final_rate);
@@ -1023,10 +1076,16 @@ typedef void (*CGPUProcRenderEncoderBindVertexBuffers)(CGPURenderPassEncoderId e
 typedef void (*CGPUProcRenderEncoderBindIndexBuffer)(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint32_t index_stride, uint64_t offset);
 typedef void (*CGPUProcRenderEncoderPushConstants)(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data);
 typedef void (*CGPUProcComputeEncoderPushConstants)(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, const char* name, const void* data);
+typedef void (*CGPUProcRenderEncoderPushConstantRange)(CGPURenderPassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
+typedef void (*CGPUProcComputeEncoderPushConstantRange)(CGPUComputePassEncoderId encoder, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
 typedef void (*CGPUProcRenderEncoderDraw)(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex);
 typedef void (*CGPUProcRenderEncoderDrawInstanced)(CGPURenderPassEncoderId encoder, uint32_t vertex_count, uint32_t first_vertex, uint32_t instance_count, uint32_t first_instance);
 typedef void (*CGPUProcRenderEncoderDrawIndexed)(CGPURenderPassEncoderId encoder, uint32_t index_count, uint32_t first_index, uint32_t first_vertex);
 typedef void (*CGPUProcRenderEncoderDrawIndexedInstanced)(CGPURenderPassEncoderId encoder, uint32_t index_count, uint32_t first_index, uint32_t instance_count, uint32_t first_instance, uint32_t first_vertex);
+typedef void (*CGPUProcRenderEncoderDrawIndirect)(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+typedef void (*CGPUProcRenderEncoderDrawIndexedIndirect)(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+typedef void (*CGPUProcRenderEncoderDrawIndirectCount)(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
+typedef void (*CGPUProcRenderEncoderDrawIndexedIndirectCount)(CGPURenderPassEncoderId encoder, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
 typedef void (*CGPUProcCmdEndRenderPass)(CGPUCommandBufferId cmd, CGPURenderPassEncoderId encoder);
 typedef void (*CGPUProcCmdBeginEvent)(CGPUCommandBufferId cmd, const CGPUEventInfo* event);
 typedef void (*CGPUProcCmdSetMarker)(CGPUCommandBufferId cmd, const CGPUMarkerInfo* marker);
@@ -1135,6 +1194,7 @@ typedef struct CGPUAdapterDetail
     ECGPUDynamicStateFeaturesFlags dynamic_state_features;
     bool                 support_host_visible_vram;
     bool                 multidraw_indirect;
+    bool                 support_draw_indirect_count;
     bool                 support_geom_shader;
     bool                 support_tessellation;
     bool                 is_uma;
@@ -1170,9 +1230,21 @@ typedef struct CGPUDeviceDescriptor
     bool                 disable_pipeline_cache;
     uint32_t             queue_group_count;
     const CGPUQueueGroupDescriptor* p_queue_groups;
+    size_t               pipeline_cache_data_size;
+    const void*          p_pipeline_cache_data;
+    uint32_t             bindless_texture_count;
+    uint32_t             bindless_buffer_count;
 
 } CGPUDeviceDescriptor;
 
+typedef struct CGPUDescriptorPoolStats
+{
+    uint32_t             pool_count;
+    uint32_t             max_sets;
+    uint32_t             allocated_sets;
+
+} CGPUDescriptorPoolStats;
+
 typedef struct CGPUDevice
 {
     CGPUAdapterId        adapter;
@@ -1203,6 +1275,13 @@ typedef struct CGPUSemaphore
 
 } CGPUSemaphore;
 
+typedef struct CGPUTimelineSemaphore
+{
+    CGPUDeviceId         device;
+    bool                 emulated;
+
+} CGPUTimelineSemaphore;
+
 typedef struct CGPUCommandPool
 {
     CGPUQueueId          queue;
@@ -1390,6 +1469,8 @@ typedef struct CGPUParameterTable
     CGPUShaderResource*  p_resources;
     uint32_t             dynamic_buffer_count;
     uint32_t             set_index;
+    uint32_t             hash_index_mask;
+    uint32_t*            p_hash_index;
 
 } CGPUParameterTable;
 
@@ -1551,6 +1632,136 @@ typedef struct CGPUDescriptorSetDescriptor
 
 } CGPUDescriptorSetDescriptor;
 
+typedef struct CGPUDescriptorArenaDescriptor
+{
+    uint32_t             max_sets_per_pool;
+
+} CGPUDescriptorArenaDescriptor;
+
+typedef struct CGPUDescriptorArena
+{
+    CGPUDeviceId         device;
+
+} CGPUDescriptorArena;
+
+typedef struct CGPUDescriptorSetCacheDescriptor
+{
+    uint32_t             capacity;
+
+} CGPUDescriptorSetCacheDescriptor;
+
+typedef struct CGPUDescriptorSetCache
+{
+    CGPUDeviceId         device;
+    uint32_t             set_count;
+    uint64_t             hit_count;
+    uint64_t             miss_count;
+
+} CGPUDescriptorSetCache;
+
+typedef struct CGPUCommandRingDescriptor
+{
+    CGPUQueueId          queue;
+    uint32_t             frame_count;
+    uint32_t             thread_count;
+
+} CGPUCommandRingDescriptor;
+
+typedef struct CGPUCommandRing
+{
+    CGPUDeviceId         device;
+    CGPUQueueId          queue;
+    uint64_t             frame_index;
+    uint32_t             command_buffer_count;
+
+} CGPUCommandRing;
+
+typedef struct CGPUUploadRingDescriptor
+{
+    uint64_t             size;
+
+} CGPUUploadRingDescriptor;
+
+typedef struct CGPUUploadRing
+{
+    CGPUDeviceId         device;
+    CGPUBufferId         buffer;
+    uint64_t             capacity;
+    uint64_t             used_bytes;
+
+} CGPUUploadRing;
+
+typedef struct CGPUUploadAllocation
+{
+    CGPUBufferId         buffer;
+    uint64_t             offset;
+    uint64_t             size;
+    void*                cpu_address;
+
+} CGPUUploadAllocation;
+
+typedef struct CGPUUploadQueueDescriptor
+{
+    CGPUQueueId          queue;
+    CGPUQueueId          consumer_queue;
+    uint64_t             page_size;
+
+} CGPUUploadQueueDescriptor;
+
+typedef struct CGPUUploadQueue
+{
+    CGPUDeviceId         device;
+    CGPUQueueId          queue;
+    CGPUTimelineSemaphoreId timeline;
+    uint64_t             submitted_token;
+
+} CGPUUploadQueue;
+
+typedef struct CGPUBufferUpload
+{
+    CGPUBufferId         buffer;
+    uint64_t             offset;
+    const void*          data;
+    uint64_t             size;
+    ECGPUResourceStateFlags dst_state;
+
+} CGPUBufferUpload;
+
+typedef struct CGPUTextureUpload
+{
+    CGPUTextureId        texture;
+    uint32_t             mip_level;
+    uint32_t             array_layer;
+    const void*          data;
+    uint64_t             size;
+    ECGPUResourceStateFlags dst_state;
+
+} CGPUTextureUpload;
+
+typedef struct CGPUReadbackRingDescriptor
+{
+    uint64_t             page_size;
+
+} CGPUReadbackRingDescriptor;
+
+typedef struct CGPUReadbackRing
+{
+    CGPUDeviceId         device;
+    uint32_t             pending_count;
+
+} CGPUReadbackRing;
+
+typedef struct CGPUBufferReadback
+{
+    CGPUBufferId         buffer;
+    uint64_t             offset;
+    uint64_t             size;
+    ECGPUResourceStateFlags src_state;
+    CGPUProcReadbackCallback callback;
+    void*                user_data;
+
+} CGPUBufferReadback;
+
 typedef struct CGPUBufferParams
 {
     const uint64_t*      offsets;
@@ -1593,6 +1804,7 @@ typedef struct CGPUDescriptorData
     CGPUDescriptorDataParams params;
     CGPUDescriptorDataResource resources;
     uint32_t             count;
+    uint32_t             slot;
 
 } CGPUDescriptorData;
 
@@ -1744,6 +1956,15 @@ typedef struct CGPUMemoryPool
 
 } CGPUMemoryPool;
 
+typedef struct CGPUMemoryPoolStatistics
+{
+    uint32_t             block_count;
+    uint32_t             allocation_count;
+    uint64_t             block_bytes;
+    uint64_t             allocation_bytes;
+
+} CGPUMemoryPoolStatistics;
+
 typedef struct CGPUQueueSubmitDescriptor
 {
     uint32_t             cmd_count;
@@ -1751,8 +1972,16 @@ typedef struct CGPUQueueSubmitDescriptor
     CGPUFenceId          signal_fence;
     uint32_t             wait_semaphore_count;
     const CGPUSemaphoreId* p_wait_semaphores;
+    const ECGPUPipelineStageFlags* p_wait_stages;
     uint32_t             signal_semaphore_count;
     const CGPUSemaphoreId* p_signal_semaphores;
+    uint32_t             wait_timeline_count;
+    const CGPUTimelineSemaphoreId* p_wait_timelines;
+    const uint64_t*      p_wait_timeline_values;
+    const ECGPUPipelineStageFlags* p_wait_timeline_stages;
+    uint32_t             signal_timeline_count;
+    const CGPUTimelineSemaphoreId* p_signal_timelines;
+    const uint64_t*      p_signal_timeline_values;
 
 } CGPUQueueSubmitDescriptor;
 
@@ -1856,6 +2085,33 @@ typedef struct CGPUPipelineReflection
 
 } CGPUPipelineReflection;
 
+typedef struct CGPUDrawIndirectArguments
+{
+    uint32_t             vertex_count;
+    uint32_t             instance_count;
+    uint32_t             first_vertex;
+    uint32_t             first_instance;
+
+} CGPUDrawIndirectArguments;
+
+typedef struct CGPUDrawIndexedIndirectArguments
+{
+    uint32_t             index_count;
+    uint32_t             instance_count;
+    uint32_t             first_index;
+    int32_t              vertex_offset;
+    uint32_t             first_instance;
+
+} CGPUDrawIndexedIndirectArguments;
+
+typedef struct CGPUDispatchIndirectArguments
+{
+    uint32_t             x;
+    uint32_t             y;
+    uint32_t             z;
+
+} CGPUDispatchIndirectArguments;
+
 typedef struct CGPUClearValue
 {
     float                color[4];
@@ -1930,9 +2186,13 @@ typedef struct CGPUBufferBarrier
     CGPUBufferId         buffer;
     ECGPUResourceStateFlags src_state;
     ECGPUResourceStateFlags dst_state;
+    ECGPUPipelineStageFlags src_stage;
+    ECGPUPipelineStageFlags dst_stage;
     uint8_t              queue_acquire;
     uint8_t              queue_release;
     ECGPUQueueType       queue_type;
+    uint64_t             offset;
+    uint64_t             size;
 
 } CGPUBufferBarrier;
 
@@ -1941,12 +2201,16 @@ typedef struct CGPUTextureBarrier
     CGPUTextureId        texture;
     ECGPUResourceStateFlags src_state;
     ECGPUResourceStateFlags dst_state;
+    ECGPUPipelineStageFlags src_stage;
+    ECGPUPipelineStageFlags dst_stage;
     uint8_t              queue_acquire;
     uint8_t              queue_release;
     ECGPUQueueType       queue_type;
     uint8_t              subresource_barrier;
     uint8_t              mip_level;
     uint16_t             array_layer;
+    uint8_t              mip_count;
+    uint16_t             array_layer_count;
 
 } CGPUTextureBarrier;
 
@@ -1971,6 +2235,24 @@ typedef struct CGPUCommandBufferDescriptor
 
 } CGPUCommandBufferDescriptor;
 
+typedef struct CGPUCommandBufferStatistics
+{
+    uint32_t             elided_state_calls;
+    uint32_t             emitted_state_calls;
+    uint32_t             requested_barriers;
+    uint32_t             emitted_barriers;
+    uint32_t             emitted_barrier_calls;
+
+} CGPUCommandBufferStatistics;
+
+typedef struct CGPUCommandBufferInheritanceInfo
+{
+    CGPURenderPassId     render_pass;
+    uint32_t             subpass;
+    CGPUFramebufferId    framebuffer;
+
+} CGPUCommandBufferInheritanceInfo;
+
 typedef struct CGPUSwapChainDescriptor
 {
     uint32_t             present_queue_count;
@@ -2026,6 +2308,7 @@ typedef struct CGPUBufferDescriptor
     ECGPUResourceStateFlags start_state;
     bool                 prefer_on_device;
     bool                 prefer_on_host;
+    CGPUMemoryPoolId     memory_pool;
 
 } CGPUBufferDescriptor;
 
@@ -2046,6 +2329,7 @@ typedef struct CGPUTextureDescriptor
     ECGPUResourceStateFlags start_state;
     ECGPUResourceTypeFlags descriptors;
     uint32_t             is_restrict_dedicated;
+    CGPUMemoryPoolId     memory_pool;
 
 } CGPUTextureDescriptor;
 
@@ -2095,6 +2379,7 @@ typedef struct CGPUBeginRenderPassInfo
     CGPUFramebufferId    framebuffer;
     uint32_t             clear_value_count;
     const CGPUClearValue* p_clear_values;
+    ECGPURenderPassContents contents;
 
 } CGPUBeginRenderPassInfo;
 
@@ -2127,6 +2412,8 @@ typedef struct CGPUProcTable
     CGPUProcQueryQueueCount query_queue_count;
     CGPUProcCreateDevice create_device;
     CGPUProcFreeDevice   free_device;
+    CGPUProcGetPipelineCacheData get_pipeline_cache_data;
+    CGPUProcQueryDescriptorPoolStats query_descriptor_pool_stats;
     CGPUProcCreateFence  create_fence;
     CGPUProcWaitFences   wait_fences;
     CGPUProcResetFences  reset_fences;
@@ -2134,6 +2421,11 @@ typedef struct CGPUProcTable
     CGPUProcFreeFence    free_fence;
     CGPUProcCreateSemaphore create_semaphore;
     CGPUProcFreeSemaphore free_semaphore;
+    CGPUProcCreateTimelineSemaphore create_timeline_semaphore;
+    CGPUProcFreeTimelineSemaphore free_timeline_semaphore;
+    CGPUProcSignalTimelineSemaphore signal_timeline_semaphore;
+    CGPUProcWaitTimelineSemaphores wait_timeline_semaphores;
+    CGPUProcQueryTimelineSemaphoreValue query_timeline_semaphore_value;
     CGPUProcCreateRootSignaturePool create_root_signature_pool;
     CGPUProcFreeRootSignaturePool free_root_signature_pool;
     CGPUProcCreateRootSignature create_root_signature;
@@ -2141,16 +2433,27 @@ typedef struct CGPUProcTable
     CGPUProcCreateDescriptorSet create_descriptor_set;
     CGPUProcFreeDescriptorSet free_descriptor_set;
     CGPUProcUpdateDescriptorSet update_descriptor_set;
+    CGPUProcCreateDescriptorArena create_descriptor_arena;
+    CGPUProcDescriptorArenaAllocateSet descriptor_arena_allocate_set;
+    CGPUProcResetDescriptorArena reset_descriptor_arena;
+    CGPUProcFreeDescriptorArena free_descriptor_arena;
+    CGPUProcRegisterBindlessTextureView register_bindless_texture_view;
+    CGPUProcRegisterBindlessBuffer register_bindless_buffer;
+    CGPUProcUnregisterBindlessTextureView unregister_bindless_texture_view;
+    CGPUProcUnregisterBindlessBuffer unregister_bindless_buffer;
+    CGPUProcAdvanceBindlessFrame advance_bindless_frame;
     CGPUProcCreateComputePipeline create_compute_pipeline;
     CGPUProcFreeComputePipeline free_compute_pipeline;
     CGPUProcCreateRenderPipeline create_render_pipeline;
     CGPUProcFreeRenderPipeline free_render_pipeline;
     CGPUProcCreateMemoryPool create_memory_pool;
     CGPUProcFreeMemoryPool free_memory_pool;
+    CGPUProcQueryMemoryPoolStatistics query_memory_pool_statistics;
     CGPUProcCreateQueryPool create_query_pool;
     CGPUProcFreeQueryPool free_query_pool;
     CGPUProcGetQueue     get_queue;
     CGPUProcSubmitQueue  submit_queue;
+    CGPUProcSubmitQueueBatches submit_queue_batches;
     CGPUProcWaitQueueIdle wait_queue_idle;
     CGPUProcQueuePresent queue_present;
     CGPUProcQueueGetTimestampPeriodNS queue_get_timestamp_period;
@@ -2173,6 +2476,7 @@ typedef struct CGPUProcTable
     CGPUProcCreateBuffer create_buffer;
     CGPUProcMapBuffer    map_buffer;
     CGPUProcUnmapBuffer  unmap_buffer;
+    CGPUProcInvalidateBuffer invalidate_buffer;
     CGPUProcFreeBuffer   free_buffer;
     CGPUProcCreateSampler create_sampler;
     CGPUProcFreeSampler  free_sampler;
@@ -2187,6 +2491,8 @@ typedef struct CGPUProcTable
     CGPUProcAcquireNextImage acquire_next_image;
     CGPUProcFreeSwapChain free_swap_chain;
     CGPUProcCmdBegin     cmd_begin;
+    CGPUProcCmdBeginSecondary cmd_begin_secondary;
+    CGPUProcCmdExecuteSecondaries cmd_execute_secondaries;
     CGPUProcCmdTransferBufferToBuffer cmd_transfer_buffer_to_buffer;
     CGPUProcCmdTransferBufferToTexture cmd_transfer_buffer_to_texture;
     CGPUProcCmdTransferBufferToTiles cmd_transfer_buffer_to_tiles;
@@ -2197,11 +2503,14 @@ typedef struct CGPUProcTable
     CGPUProcCmdResetQueryPool cmd_reset_query_pool;
     CGPUProcCmdResolveQuery cmd_resolve_query;
     CGPUProcCmdEnd       cmd_end;
+    CGPUProcQueryCommandBufferStatistics query_command_buffer_statistics;
     CGPUProcCmdBeginComputePass cmd_begin_compute_pass;
     CGPUProcComputeEncoderBindDescriptorSet compute_encoder_bind_descriptor_set;
     CGPUProcComputeEncoderPushConstants compute_encoder_push_constants;
+    CGPUProcComputeEncoderPushConstantRange compute_encoder_push_constant_range;
     CGPUProcComputeEncoderBindPipeline compute_encoder_bind_pipeline;
     CGPUProcComputeEncoderDispatch compute_encoder_dispatch;
+    CGPUProcComputeEncoderDispatchIndirect compute_encoder_dispatch_indirect;
     CGPUProcCmdEndComputePass cmd_end_compute_pass;
     CGPUProcCmdBeginRenderPass cmd_begin_render_pass;
     CGPUProcRenderEncoderSetShadingRate render_encoder_set_shading_rate;
@@ -2210,12 +2519,17 @@ typedef struct CGPUProcTable
     CGPUProcRenderEncoderBindVertexBuffers render_encoder_bind_vertex_buffers;
     CGPUProcRenderEncoderBindIndexBuffer render_encoder_bind_index_buffer;
     CGPUProcRenderEncoderPushConstants render_encoder_push_constants;
+    CGPUProcRenderEncoderPushConstantRange render_encoder_push_constant_range;
     CGPUProcRenderEncoderSetViewport render_encoder_set_viewport;
     CGPUProcRenderEncoderSetScissor render_encoder_set_scissor;
     CGPUProcRenderEncoderDraw render_encoder_draw;
     CGPUProcRenderEncoderDrawInstanced render_encoder_draw_instanced;
     CGPUProcRenderEncoderDrawIndexed render_encoder_draw_indexed;
     CGPUProcRenderEncoderDrawIndexedInstanced render_encoder_draw_indexed_instanced;
+    CGPUProcRenderEncoderDrawIndirect render_encoder_draw_indirect;
+    CGPUProcRenderEncoderDrawIndexedIndirect render_encoder_draw_indexed_indirect;
+    CGPUProcRenderEncoderDrawIndirectCount render_encoder_draw_indirect_count;
+    CGPUProcRenderEncoderDrawIndexedIndirectCount render_encoder_draw_indexed_indirect_count;
     CGPUProcCmdEndRenderPass cmd_end_render_pass;
     CGPUProcCmdBeginEvent cmd_begin_event;
     CGPUProcCmdSetMarker cmd_set_marker;
@@ -2281,18 +2595,42 @@ CGPU_API const CGPUAdapterDetail* cgpu_adapter_query_adapter_detail(const CGPUAd
 CGPU_API uint32_t cgpu_adapter_query_queue_count(const CGPUAdapterId _this, ECGPUQueueType type);
 CGPU_API CGPUDeviceId cgpu_adapter_create_device(CGPUAdapterId _this, const CGPUDeviceDescriptor* desc);
 CGPU_API void cgpu_adapter_free_device(CGPUAdapterId _this, CGPUDeviceId device);
+CGPU_API size_t cgpu_device_get_pipeline_cache_data(CGPUDeviceId _this, size_t size, void* data);
+CGPU_API void cgpu_device_query_descriptor_pool_stats(CGPUDeviceId _this, CGPUDescriptorPoolStats* stats);
 CGPU_API void cgpu_device_query_video_memory_info(CGPUDeviceId _this, uint64_t* total, uint64_t* used);
 CGPU_API void cgpu_device_query_shared_memory_info(CGPUDeviceId _this, uint64_t* total, uint64_t* used);
 CGPU_API CGPUFenceId cgpu_device_create_fence(CGPUDeviceId _this);
 CGPU_API void cgpu_device_free_fence(CGPUDeviceId _this, CGPUFenceId fence);
 CGPU_API CGPUSemaphoreId cgpu_device_create_semaphore(CGPUDeviceId _this);
 CGPU_API void cgpu_device_free_semaphore(CGPUDeviceId _this, CGPUSemaphoreId semaphore);
+CGPU_API CGPUTimelineSemaphoreId cgpu_device_create_timeline_semaphore(CGPUDeviceId _this, uint64_t initial_value);
+CGPU_API void cgpu_device_free_timeline_semaphore(CGPUDeviceId _this, CGPUTimelineSemaphoreId semaphore);
+CGPU_API bool cgpu_wait_timeline_semaphores(uint32_t semaphore_count, const CGPUTimelineSemaphoreId* p_semaphores, const uint64_t* p_values, uint64_t timeout_ns);
+CGPU_API void cgpu_timeline_semaphore_signal(CGPUTimelineSemaphoreId _this, uint64_t value);
+CGPU_API uint64_t cgpu_timeline_semaphore_query_value(CGPUTimelineSemaphoreId _this);
 CGPU_API CGPURootSignaturePoolId cgpu_device_create_root_signature_pool(CGPUDeviceId _this, const CGPURootSignaturePoolDescriptor* desc);
 CGPU_API void cgpu_device_free_root_signature_pool(CGPUDeviceId _this, CGPURootSignaturePoolId pool);
 CGPU_API CGPURootSignatureId cgpu_device_create_root_signature(CGPUDeviceId _this, const CGPURootSignatureDescriptor* desc);
 CGPU_API void cgpu_device_free_root_signature(CGPUDeviceId _this, CGPURootSignatureId signature);
 CGPU_API CGPUDescriptorSetId cgpu_device_create_descriptor_set(CGPUDeviceId _this, const CGPUDescriptorSetDescriptor* desc);
 CGPU_API void cgpu_device_free_descriptor_set(CGPUDeviceId _this, CGPUDescriptorSetId set);
+CGPU_API CGPUDescriptorArenaId cgpu_device_create_descriptor_arena(CGPUDeviceId _this, const CGPUDescriptorArenaDescriptor* desc);
+CGPU_API void cgpu_device_free_descriptor_arena(CGPUDeviceId _this, CGPUDescriptorArenaId arena);
+CGPU_API CGPUDescriptorSetCacheId cgpu_device_create_descriptor_set_cache(CGPUDeviceId _this, const CGPUDescriptorSetCacheDescriptor* desc);
+CGPU_API void cgpu_device_free_descriptor_set_cache(CGPUDeviceId _this, CGPUDescriptorSetCacheId cache);
+CGPU_API CGPUCommandRingId cgpu_device_create_command_ring(CGPUDeviceId _this, const CGPUCommandRingDescriptor* desc);
+CGPU_API void cgpu_device_free_command_ring(CGPUDeviceId _this, CGPUCommandRingId ring);
+CGPU_API CGPUUploadRingId cgpu_device_create_upload_ring(CGPUDeviceId _this, const CGPUUploadRingDescriptor* desc);
+CGPU_API void cgpu_device_free_upload_ring(CGPUDeviceId _this, CGPUUploadRingId ring);
+CGPU_API CGPUReadbackRingId cgpu_device_create_readback_ring(CGPUDeviceId _this, const CGPUReadbackRingDescriptor* desc);
+CGPU_API void cgpu_device_free_readback_ring(CGPUDeviceId _this, CGPUReadbackRingId ring);
+CGPU_API CGPUUploadQueueId cgpu_device_create_upload_queue(CGPUDeviceId _this, const CGPUUploadQueueDescriptor* desc);
+CGPU_API void cgpu_device_free_upload_queue(CGPUDeviceId _this, CGPUUploadQueueId queue);
+CGPU_API uint32_t cgpu_device_register_texture_view(CGPUDeviceId _this, CGPUTextureViewId view);
+CGPU_API uint32_t cgpu_device_register_buffer(CGPUDeviceId _this, CGPUBufferId buffer);
+CGPU_API void cgpu_device_unregister_texture_view(CGPUDeviceId _this, uint32_t index);
+CGPU_API void cgpu_device_unregister_buffer(CGPUDeviceId _this, uint32_t index);
+CGPU_API void cgpu_device_advance_bindless_frame(CGPUDeviceId _this, CGPUFenceId fence);
 CGPU_API CGPUComputePipelineId cgpu_device_create_compute_pipeline(CGPUDeviceId _this, const CGPUComputePipelineDescriptor* desc);
 CGPU_API void cgpu_device_free_compute_pipeline(CGPUDeviceId _this, CGPUComputePipelineId pipeline);
 CGPU_API CGPURenderPipelineId cgpu_device_create_render_pipeline(CGPUDeviceId _this, const CGPURenderPipelineDescriptor* desc);
@@ -2301,6 +2639,7 @@ CGPU_API CGPUQueryPoolId cgpu_device_create_query_pool(CGPUDeviceId _this, const
 CGPU_API void cgpu_device_free_query_pool(CGPUDeviceId _this, CGPUQueryPoolId pool);
 CGPU_API CGPUMemoryPoolId cgpu_device_create_memory_pool(CGPUDeviceId _this, const CGPUMemoryPoolDescriptor* desc);
 CGPU_API void cgpu_device_free_memory_pool(CGPUDeviceId _this, CGPUMemoryPoolId pool);
+CGPU_API void cgpu_memory_pool_query_statistics(CGPUMemoryPoolId _this, CGPUMemoryPoolStatistics* stats);
 CGPU_API CGPUQueueId cgpu_device_get_queue(CGPUDeviceId _this, ECGPUQueueType type, uint32_t index);
 CGPU_API void cgpu_device_free_queue(CGPUDeviceId _this, CGPUQueueId queue);
 CGPU_API CGPURenderPassId cgpu_device_create_render_pass(CGPUDeviceId _this, const CGPURenderPassDescriptor* desc);
@@ -2326,6 +2665,7 @@ CGPU_API void cgpu_wait_fences(uint32_t fence_count, const CGPUFenceId* p_fences
 CGPU_API void cgpu_reset_fences(uint32_t fence_count, const CGPUFenceId* p_fences);
 CGPU_API ECGPUFenceStatus cgpu_fence_query_status(CGPUFenceId _this);
 CGPU_API ECGPUSubmitError cgpu_queue_submit(CGPUQueueId _this, const CGPUQueueSubmitDescriptor* desc);
+CGPU_API ECGPUSubmitError cgpu_queue_submit_batches(CGPUQueueId _this, uint32_t batch_count, const CGPUQueueSubmitDescriptor* p_descs);
 CGPU_API ECGPUPresentError cgpu_queue_present(CGPUQueueId _this, const CGPUQueuePresentDescriptor* desc);
 CGPU_API void cgpu_queue_wait_idle(CGPUQueueId _this);
 CGPU_API float cgpu_queue_get_timestamp_period_ns(CGPUQueueId _this);
@@ -2335,14 +2675,40 @@ CGPU_API void cgpu_queue_map_packed_mips(CGPUQueueId _this, const CGPUTiledTextu
 CGPU_API void cgpu_queue_unmap_packed_mips(CGPUQueueId _this, const CGPUTiledTexturePackedMips* desc);
 CGPU_API CGPUCommandPoolId cgpu_queue_create_command_pool(CGPUQueueId _this, const CGPUCommandPoolDescriptor* desc);
 CGPU_API void cgpu_queue_free_command_pool(CGPUQueueId _this, CGPUCommandPoolId pool);
+CGPU_API uint32_t cgpu_root_signature_resolve_binding(const CGPURootSignatureId _this, const char* name);
+CGPU_API uint32_t cgpu_root_signature_resolve_push_constant(const CGPURootSignatureId _this, const char* name);
 CGPU_API void cgpu_descriptor_set_update(CGPUDescriptorSetId _this, uint32_t data_count, const CGPUDescriptorData* p_datas);
+CGPU_API CGPUDescriptorSetId cgpu_descriptor_arena_allocate_set(CGPUDescriptorArenaId _this, const CGPUDescriptorSetDescriptor* desc);
+CGPU_API void cgpu_descriptor_arena_reset(CGPUDescriptorArenaId _this);
+CGPU_API CGPUDescriptorSetId cgpu_descriptor_set_cache_acquire_set(CGPUDescriptorSetCacheId _this, const CGPUDescriptorSetDescriptor* desc, uint32_t data_count, const CGPUDescriptorData* p_datas);
+CGPU_API void cgpu_descriptor_set_cache_advance_frame(CGPUDescriptorSetCacheId _this, CGPUFenceId fence);
+CGPU_API void cgpu_descriptor_set_cache_clear(CGPUDescriptorSetCacheId _this);
+CGPU_API CGPUCommandBufferId cgpu_command_ring_acquire_command_buffer(CGPUCommandRingId _this, uint32_t thread_index, bool is_secondary);
+CGPU_API void cgpu_command_ring_advance_frame(CGPUCommandRingId _this, CGPUFenceId fence);
+CGPU_API bool cgpu_upload_ring_allocate(CGPUUploadRingId _this, uint64_t size, uint64_t alignment, CGPUUploadAllocation* allocation);
+CGPU_API void cgpu_upload_ring_advance_frame(CGPUUploadRingId _this, CGPUFenceId fence);
+CGPU_API uint64_t cgpu_readback_ring_read_buffer(CGPUReadbackRingId _this, CGPUCommandBufferId cmd, const CGPUBufferReadback* desc);
+CGPU_API void cgpu_readback_ring_advance_frame(CGPUReadbackRingId _this, CGPUFenceId fence);
+CGPU_API void cgpu_readback_ring_poll(CGPUReadbackRingId _this);
+CGPU_API bool cgpu_readback_ring_is_ready(CGPUReadbackRingId _this, uint64_t ticket);
+CGPU_API const void* cgpu_readback_ring_map(CGPUReadbackRingId _this, uint64_t ticket);
+CGPU_API void cgpu_readback_ring_release(CGPUReadbackRingId _this, uint64_t ticket);
+CGPU_API uint64_t cgpu_upload_queue_upload_buffer(CGPUUploadQueueId _this, const CGPUBufferUpload* desc);
+CGPU_API uint64_t cgpu_upload_queue_upload_texture(CGPUUploadQueueId _this, const CGPUTextureUpload* desc);
+CGPU_API uint64_t cgpu_upload_queue_flush(CGPUUploadQueueId _this);
+CGPU_API bool cgpu_upload_queue_is_complete(CGPUUploadQueueId _this, uint64_t token);
+CGPU_API void cgpu_upload_queue_wait(CGPUUploadQueueId _this, uint64_t token);
+CGPU_API void cgpu_upload_queue_record_acquire_barriers(CGPUUploadQueueId _this, CGPUCommandBufferId cmd, uint64_t token);
 CGPU_API CGPUCommandBufferId cgpu_command_pool_create_command_buffer(CGPUCommandPoolId _this, const CGPUCommandBufferDescriptor* desc);
 CGPU_API void cgpu_command_pool_reset(CGPUCommandPoolId _this);
 CGPU_API void cgpu_command_pool_free_command_buffer(CGPUCommandPoolId _this, CGPUCommandBufferId cmd);
 CGPU_API void cgpu_buffer_map(CGPUBufferId _this, const CGPUBufferRange* range);
 CGPU_API void cgpu_buffer_unmap(CGPUBufferId _this);
+CGPU_API void cgpu_buffer_invalidate(CGPUBufferId _this, const CGPUBufferRange* range);
 CGPU_API ECGPUAcquireNextImageError cgpu_swap_chain_acquire_next_image(CGPUSwapChainId _this, const CGPUAcquireNextDescriptor* desc, uint32_t* p_image_index);
 CGPU_API void cgpu_command_buffer_begin(CGPUCommandBufferId _this);
+CGPU_API CGPURenderPassEncoderId cgpu_command_buffer_begin_secondary(CGPUCommandBufferId _this, const CGPUCommandBufferInheritanceInfo* inheritance);
+CGPU_API void cgpu_command_buffer_execute_secondaries(CGPUCommandBufferId _this, uint32_t count, const CGPUCommandBufferId* p_secondaries);
 CGPU_API void cgpu_command_buffer_transfer_buffer_to_buffer(CGPUCommandBufferId _this, const CGPUBufferToBufferTransfer* desc);
 CGPU_API void cgpu_command_buffer_transfer_texture_to_texture(CGPUCommandBufferId _this, const CGPUTextureToTextureTransfer* desc);
 CGPU_API void cgpu_command_buffer_transfer_buffer_to_texture(CGPUCommandBufferId _this, const CGPUBufferToTextureTransfer* desc);
@@ -2353,6 +2719,7 @@ CGPU_API void cgpu_command_buffer_end_query(CGPUCommandBufferId _this, CGPUQuery
 CGPU_API void cgpu_command_buffer_reset_query_pool(CGPUCommandBufferId _this, CGPUQueryPoolId pool, uint32_t start_query, uint32_t query_count);
 CGPU_API void cgpu_command_buffer_resolve_query(CGPUCommandBufferId _this, CGPUQueryPoolId pool, CGPUBufferId readback, uint32_t start_query, uint32_t query_count);
 CGPU_API void cgpu_command_buffer_end(CGPUCommandBufferId _this);
+CGPU_API void cgpu_command_buffer_query_statistics(CGPUCommandBufferId _this, CGPUCommandBufferStatistics* stats);
 CGPU_API CGPUComputePassEncoderId cgpu_command_buffer_begin_compute_pass(CGPUCommandBufferId _this, const CGPUComputePassDescriptor* desc);
 CGPU_API void cgpu_command_buffer_end_compute_pass(CGPUCommandBufferId _this, CGPUComputePassEncoderId encoder);
 CGPU_API CGPURenderPassEncoderId cgpu_command_buffer_begin_render_pass(CGPUCommandBufferId _this, const CGPUBeginRenderPassInfo* begin_info);
@@ -2367,7 +2734,9 @@ CGPU_API void cgpu_command_buffer_free_binder(CGPUCommandBufferId _this, CGPUBin
 CGPU_API void cgpu_compute_pass_encoder_bind_descriptor_set(CGPUComputePassEncoderId _this, CGPUDescriptorSetId set, uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
 CGPU_API void cgpu_compute_pass_encoder_bind_compute_pipeline(CGPUComputePassEncoderId _this, CGPUComputePipelineId pipeline);
 CGPU_API void cgpu_compute_pass_encoder_dispatch(CGPUComputePassEncoderId _this, uint32_t x, uint32_t y, uint32_t z);
+CGPU_API void cgpu_compute_pass_encoder_dispatch_indirect(CGPUComputePassEncoderId _this, CGPUBufferId buffer, uint64_t offset);
 CGPU_API void cgpu_compute_pass_encoder_push_constants(CGPUComputePassEncoderId _this, CGPURootSignatureId rs, const char* name, const void* data);
+CGPU_API void cgpu_compute_pass_encoder_push_constant_range(CGPUComputePassEncoderId _this, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
 CGPU_API void cgpu_compute_pass_encoder_bind_state_buffer(CGPUComputePassEncoderId _this, CGPUStateBufferId stream);
 CGPU_API void cgpu_render_pass_encoder_set_shading_rate(CGPURenderPassEncoderId _this, ECGPUShadingRate shading_rate, ECGPUShadingRateCombiner post_rasterize_rate, ECGPUShadingRateCombiner final_rate);
 CGPU_API void cgpu_render_pass_encoder_bind_descriptor_set(CGPURenderPassEncoderId _this, CGPUDescriptorSetId set, uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
@@ -2377,10 +2746,15 @@ CGPU_API void cgpu_render_pass_encoder_bind_render_pipeline(CGPURenderPassEncode
 CGPU_API void cgpu_render_pass_encoder_bind_vertex_buffers(CGPURenderPassEncoderId _this, uint32_t buffer_count, const CGPUBufferId* p_buffers, const uint32_t* p_strides, const uint32_t* p_offsets);
 CGPU_API void cgpu_render_pass_encoder_bind_index_buffer(CGPURenderPassEncoderId _this, CGPUBufferId buffer, uint32_t index_stride, uint64_t offset);
 CGPU_API void cgpu_render_pass_encoder_push_constants(CGPURenderPassEncoderId _this, CGPURootSignatureId rs, const char* name, const void* data);
+CGPU_API void cgpu_render_pass_encoder_push_constant_range(CGPURenderPassEncoderId _this, CGPURootSignatureId rs, uint32_t slot, uint32_t offset, uint32_t size, const void* data);
 CGPU_API void cgpu_render_pass_encoder_draw(CGPURenderPassEncoderId _this, uint32_t vertex_count, uint32_t first_vertex);
 CGPU_API void cgpu_render_pass_encoder_draw_instanced(CGPURenderPassEncoderId _this, uint32_t vertex_count, uint32_t first_vertex, uint32_t instance_count, uint32_t first_instance);
 CGPU_API void cgpu_render_pass_encoder_draw_indexed(CGPURenderPassEncoderId _this, uint32_t index_count, uint32_t first_index, uint32_t first_vertex);
 CGPU_API void cgpu_render_pass_encoder_draw_indexed_instanced(CGPURenderPassEncoderId _this, uint32_t index_count, uint32_t first_index, uint32_t instance_count, uint32_t first_instance, uint32_t first_vertex);
+CGPU_API void cgpu_render_pass_encoder_draw_indirect(CGPURenderPassEncoderId _this, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+CGPU_API void cgpu_render_pass_encoder_draw_indexed_indirect(CGPURenderPassEncoderId _this, CGPUBufferId buffer, uint64_t offset, uint32_t draw_count, uint32_t stride);
+CGPU_API void cgpu_render_pass_encoder_draw_indirect_count(CGPURenderPassEncoderId _this, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
+CGPU_API void cgpu_render_pass_encoder_draw_indexed_indirect_count(CGPURenderPassEncoderId _this, CGPUBufferId buffer, uint64_t offset, CGPUBufferId count_buffer, uint64_t count_buffer_offset, uint32_t max_draw_count, uint32_t stride);
 CGPU_API void cgpu_render_pass_encoder_bind_state_buffer(CGPURenderPassEncoderId _this, CGPUStateBufferId stream);
 CGPU_API CGPULinkedShaderId cgpu_root_signature_compile_and_link_shaders(CGPURootSignatureId _this, uint32_t count, const CGPUCompiledShaderDescriptor* desc);
 CGPU_API void cgpu_root_signature_compile_shaders(CGPURootSignatureId _this, uint32_t count, const CGPUCompiledShaderDescriptor* desc, CGPUCompiledShaderId* out_isas);
@@ -131,14 +131,14 @@ const WaitUploadTextureQueue = struct {
 
         while (self.queue.count > 0) {
             const item = self.queue.readItem().?;
-            const buffer_barrier: cgpu.BufferBarrier = .{ .buffer = item.stage_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .copy_source = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics };
-            const texture_barrier: cgpu.TextureBarrier = .{ .texture = item.texture, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .copy_dest = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0 };
+            const buffer_barrier: cgpu.BufferBarrier = .{ .buffer = item.stage_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .copy_source = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .offset = 0, .size = 0 };
+            const texture_barrier: cgpu.TextureBarrier = .{ .texture = item.texture, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .copy_dest = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0, .mip_count = 0, .array_layer_count = 0 };
             const barrier_descriptor: cgpu.ResourceBarrierDescriptor = .{ .buffer_barrier_count = 1, .p_buffer_barriers = &[_]cgpu.BufferBarrier{buffer_barrier}, .texture_barrier_count = 1, .p_texture_barriers = &[_]cgpu.TextureBarrier{texture_barrier} };
             cmd.resourceBarrier(&barrier_descriptor);
 
             cmd.transferBufferToTexture(&.{ .src = item.stage_buffer, .src_offset = 0, .dst = item.texture, .dst_subresource = .{ .aspects = .{ .color = true }, .mip_level = 0, .base_array_layer = 0, .layer_count = 1 } });
 
-            const texture_barrier2: cgpu.TextureBarrier = .{ .texture = item.texture, .src_state = cgpu.ResourceState{ .copy_dest = true }, .dst_state = cgpu.ResourceState.shader_resource, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0 };
+            const texture_barrier2: cgpu.TextureBarrier = .{ .texture = item.texture, .src_state = cgpu.ResourceState{ .copy_dest = true }, .dst_state = cgpu.ResourceState.shader_resource, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0, .mip_count = 0, .array_layer_count = 0 };
             const barrier_descriptor2: cgpu.ResourceBarrierDescriptor = .{ .buffer_barrier_count = 0, .p_buffer_barriers = &[_]cgpu.BufferBarrier{}, .texture_barrier_count = 1, .p_texture_barriers = &[_]cgpu.TextureBarrier{texture_barrier2} };
             cmd.resourceBarrier(&barrier_descriptor2);
 
@@ -227,6 +227,9 @@ pub fn main() !void {
         .disable_pipeline_cache = false,
         .queue_group_count = 1,
         .p_queue_groups = &[_]cgpu.QueueGroupDescriptor{queue_group_descriptor},
+        .pipeline_cache_data_size = 0,
+        .bindless_texture_count = 0,
+        .bindless_buffer_count = 0,
     };
 
     const device = try adapter.createDevice(&device_descriptor);
@@ -432,8 +435,8 @@ pub fn main() !void {
 
     const imgui_font_descriptor_set = try device.createDescriptorSet(&.{ .root_signature = imgui_shader.root_sig, .set_index = 0 });
     imgui_font_descriptor_set.update(2, &[_]cgpu.DescriptorData{
-        .{ .name = null, .binding = 0, .binding_type = .{ .texture = true }, .count = 1, .params = .{ .enable_stencil_resource = false }, .resources = .{ .textures = &[_]cgpu.TextureViewId{imgui_font_texture_view} } },
-        .{ .name = null, .binding = 1, .binding_type = .{ .sampler = true }, .count = 1, .params = .{ .enable_stencil_resource = false }, .resources = .{ .samplers = &[_]cgpu.SamplerId{imgui_font_texture_sampler} } },
+        .{ .name = null, .binding = 0, .binding_type = .{ .texture = true }, .count = 1, .slot = cgpu.InvalidBindingSlot, .params = .{ .enable_stencil_resource = false }, .resources = .{ .textures = &[_]cgpu.TextureViewId{imgui_font_texture_view} } },
+        .{ .name = null, .binding = 1, .binding_type = .{ .sampler = true }, .count = 1, .slot = cgpu.InvalidBindingSlot, .params = .{ .enable_stencil_resource = false }, .resources = .{ .samplers = &[_]cgpu.SamplerId{imgui_font_texture_sampler} } },
     });
     defer device.freeDescriptorSet(imgui_font_descriptor_set);
     var frame_datas: [3]FrameData = undefined;
@@ -600,17 +603,17 @@ pub fn main() !void {
             imgui_vertex_buffer.unmap();
             imgui_index_buffer.unmap();
 
-            const buffer_barrier1: cgpu.BufferBarrier = .{ .buffer = imgui_vertex_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .vertex_and_constant_buffer = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics };
-            const buffer_barrier2: cgpu.BufferBarrier = .{ .buffer = imgui_index_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .index_buffer = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics };
+            const buffer_barrier1: cgpu.BufferBarrier = .{ .buffer = imgui_vertex_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .vertex_and_constant_buffer = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .offset = 0, .size = 0 };
+            const buffer_barrier2: cgpu.BufferBarrier = .{ .buffer = imgui_index_buffer, .src_state = cgpu.ResourceState{}, .dst_state = cgpu.ResourceState{ .index_buffer = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = .graphics, .offset = 0, .size = 0 };
             const barrier_descriptor: cgpu.ResourceBarrierDescriptor = .{ .buffer_barrier_count = 1, .p_buffer_barriers = &[_]cgpu.BufferBarrier{ buffer_barrier1, buffer_barrier2 }, .texture_barrier_count = 0, .p_texture_barriers = &[_]cgpu.TextureBarrier{} };
             cmd.resourceBarrier(&barrier_descriptor);
         }
 
-        const texture_barrier: cgpu.TextureBarrier = .{ .texture = current_swapchain_info.back_buffer_texture, .src_state = .{}, .dst_state = cgpu.ResourceState{ .render_target = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = queue._type, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0 };
+        const texture_barrier: cgpu.TextureBarrier = .{ .texture = current_swapchain_info.back_buffer_texture, .src_state = .{}, .dst_state = cgpu.ResourceState{ .render_target = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = queue._type, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0, .mip_count = 0, .array_layer_count = 0 };
         const barrier_descriptor: cgpu.ResourceBarrierDescriptor = .{ .buffer_barrier_count = 0, .p_buffer_barriers = &[_]cgpu.BufferBarrier{}, .texture_barrier_count = 1, .p_texture_barriers = &[_]cgpu.TextureBarrier{texture_barrier} };
         cmd.resourceBarrier(&barrier_descriptor);
 
-        const encoder = try cmd.beginRenderPass(&.{ .render_pass = render_pass, .framebuffer = current_swapchain_info.framebuffer, .clear_value_count = 1, .p_clear_values = &[_]cgpu.ClearValue{cgpu.ClearValue{ .color = [4]f32{ 0, 0, 0, 1 }, .depth = 1, .stencil = 0, .is_color = true }} });
+        const encoder = try cmd.beginRenderPass(&.{ .render_pass = render_pass, .framebuffer = current_swapchain_info.framebuffer, .clear_value_count = 1, .p_clear_values = &[_]cgpu.ClearValue{cgpu.ClearValue{ .color = [4]f32{ 0, 0, 0, 1 }, .depth = 1, .stencil = 0, .is_color = true }}, .contents = .inline_commands });
 
         encoder.setShadingRate(.full, .pass_through, .pass_through);
         encoder.setViewport(0, 0, fw, fh, 0, 1);
@@ -656,13 +659,13 @@ pub fn main() !void {
 
         cmd.endRenderPass(encoder);
 
-        const texture_barrier2: cgpu.TextureBarrier = .{ .texture = current_swapchain_info.back_buffer_texture, .src_state = .{ .render_target = true }, .dst_state = cgpu.ResourceState{ .present = true }, .queue_acquire = 0, .queue_release = 0, .queue_type = queue._type, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0 };
+        const texture_barrier2: cgpu.TextureBarrier = .{ .texture = current_swapchain_info.back_buffer_texture, .src_state = .{ .render_target = true }, .dst_state = cgpu.ResourceState{ .present = true }, .src_stage = .{}, .dst_stage = .{}, .queue_acquire = 0, .queue_release = 0, .queue_type = queue._type, .subresource_barrier = 0, .mip_level = 0, .array_layer = 0, .mip_count = 0, .array_layer_count = 0 };
         const barrier_descriptor2: cgpu.ResourceBarrierDescriptor = .{ .buffer_barrier_count = 0, .p_buffer_barriers = &[_]cgpu.BufferBarrier{}, .texture_barrier_count = 1, .p_texture_barriers = &[_]cgpu.TextureBarrier{texture_barrier2} };
         cmd.resourceBarrier(&barrier_descriptor2);
 
         cmd.end();
 
-        _ = queue.submit(&.{ .cmd_count = 1, .p_cmds = &[_]cgpu.CommandBufferId{cmd}, .signal_fence = current_frame_data.inflight_fence, .wait_semaphore_count = 1, .p_wait_semaphores = &[_]cgpu.SemaphoreId{current_frame_data.swapchain_prepared_semaphore}, .signal_semaphore_count = 1, .p_signal_semaphores = &[_]cgpu.SemaphoreId{current_swapchain_info.render_finished_semaphore} });
+        _ = queue.submit(&.{ .cmd_count = 1, .p_cmds = &[_]cgpu.CommandBufferId{cmd}, .signal_fence = current_frame_data.inflight_fence, .wait_semaphore_count = 1, .p_wait_semaphores = &[_]cgpu.SemaphoreId{current_frame_data.swapchain_prepared_semaphore}, .signal_semaphore_count = 1, .p_signal_semaphores = &[_]cgpu.SemaphoreId{current_swapchain_info.render_finished_semaphore}, .wait_timeline_count = 0, .signal_timeline_count = 0 });
 
         _ = queue.present(&.{ .swapchain = swapchain, .wait_semaphore_count = 1, .p_wait_semaphores = &[_]cgpu.SemaphoreId{current_swapchain_info.render_finished_semaphore}, .index = @intCast(p_image_index) });
     }